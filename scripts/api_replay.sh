@@ -0,0 +1,42 @@
+# Api Replay
+# 10/19/26
+
+#!/bin/bash
+
+# Host (Linux) Build Of driver_api Against The Local Stub Server
+# Usage : api_replay.sh [build]
+
+# Get The Path Where This Shell Script Is
+SCRIPT_DIR="$(dirname "$(readlink -f "$0")")"
+PROJECT_DIR="$SCRIPT_DIR/../src/projects/test_api_replay"
+
+# Source Color Definitions
+source $SCRIPT_DIR/colors.sh
+
+cd "$PROJECT_DIR" || exit 1
+
+if [ "$1" = "build" ] || [ ! -f build/Test_Api_Replay.elf ]; then
+    printf "${LIGHT_YELLOW}*** build ***${ENDCOLOR}\n"
+    idf.py --preview set-target linux && idf.py build
+    if [ $? -ne 0 ]; then
+        printf "${LIGHT_RED}Build Failed. Exiting!${ENDCOLOR}\n"
+        exit 1
+    fi
+fi
+
+# Start Stub & Wait For It To Listen
+python3 stub/api_stub.py &
+STUB_PID=$!
+trap "kill $STUB_PID 2>/dev/null" EXIT
+sleep 1
+
+printf "${LIGHT_YELLOW}*** replay ***${ENDCOLOR}\n"
+./build/Test_Api_Replay.elf
+RESULT=$?
+
+if [ $RESULT -ne 0 ]; then
+    printf "${LIGHT_RED}Replay Failed ($RESULT)${ENDCOLOR}\n"
+    exit 1
+fi
+printf "${LIGHT_GREEN}Replay Passed${ENDCOLOR}\n"
+exit 0
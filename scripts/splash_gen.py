@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+
+# Splash Gen
+# 10/19/26
+
+# Converts A Png Into The Run Length Encoded RGB565 Splash Painted By driver_lcd Before Lvgl Starts
+# Default Source Is The Boot Golden Frame Of test_ui_render, Which Matches Lvgl's First Frame
+# So The Handover From Splash To Ui Shows No Visible Change
+# Png Must Be 8 Bit RGB / RGBA, Non Interlaced & Exactly The Display Resolution
+# Run By The driver_lcd Component Build (Output Goes To The Build Directory, Not The Source Tree)
+# Usage : splash_gen.py [input.png] output.c
+
+import os
+import struct
+import sys
+import zlib
+
+SCRIPT_DIR = os.path.dirname(os.path.realpath(__file__))
+PNG_DEFAULT = os.path.join(SCRIPT_DIR, "../src/projects/test_ui_render/golden/boot.png")
+
+HRES = 800
+VRES = 480
+RUN_MAX = 0xFFFF
+WORDS_PER_LINE = 12
+
+
+def png_read(path):
+    # Minimal Png Decoder (No Pillow Needed). Returns (width, height, rows Of RGB Tuples)
+
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("Not A Png")
+
+    pos = 8
+    idat = b""
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+
+    if depth != 8 or color not in (2, 6) or interlace:
+        raise ValueError("Need 8 Bit RGB / RGBA, Non Interlaced")
+
+    bpp = 3 if color == 2 else 4
+    stride = width * bpp
+    raw = zlib.decompress(idat)
+    prev = bytearray(stride)
+    rows = []
+
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if (pa <= pb and pa <= pc) else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        rows.append([tuple(line[x * bpp:x * bpp + 3]) for x in range(width)])
+        prev = line
+
+    return width, height, rows
+
+
+def rle_encode(rows):
+    # (Count, RGB565) Word Pairs In Scan Order. Runs May Cross Lines
+
+    words = []
+    run_color = None
+    run_len = 0
+
+    for row in rows:
+        for r, g, b in row:
+            color = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+            if color == run_color and run_len < RUN_MAX:
+                run_len += 1
+                continue
+            if run_len:
+                words += [run_len, run_color]
+            run_color = color
+            run_len = 1
+    if run_len:
+        words += [run_len, run_color]
+
+    return words
+
+
+def c_write(path, words, source):
+    # Generated Source For driver_lcd
+
+    with open(path, "w") as f:
+        f.write("// DRIVER_LCD SPLASH\n")
+        f.write("// GENERATED BY scripts/splash_gen.py FROM %s. DO NOT EDIT\n\n" % source)
+        f.write("#include <stdint.h>\n\n")
+        f.write("// %u x %u RGB565, Run Length Encoded As (Count, Color) Pairs\n" % (HRES, VRES))
+        f.write("const uint32_t driver_lcd_splash_rle_len = %u;\n" % len(words))
+        f.write("const uint16_t driver_lcd_splash_rle[%u] = {\n" % len(words))
+        for i in range(0, len(words), WORDS_PER_LINE):
+            f.write("    " + ", ".join("0x%04x" % w for w in words[i:i + WORDS_PER_LINE]) + ",\n")
+        f.write("};\n")
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        sys.stderr.write("Usage : splash_gen.py [input.png] output.c\n")
+        sys.exit(1)
+    src = sys.argv[1] if len(sys.argv) > 2 else PNG_DEFAULT
+    out = sys.argv[-1]
+
+    width, height, rows = png_read(src)
+    if (width, height) != (HRES, VRES):
+        sys.stderr.write("Png Is %u x %u, Need %u x %u\n" % (width, height, HRES, VRES))
+        sys.exit(1)
+
+    words = rle_encode(rows)
+    c_write(out, words, os.path.relpath(os.path.realpath(src), os.path.join(SCRIPT_DIR, "..")))
+    print("%u Runs, %u B Flash (Raw %u B) -> %s" % (len(words) // 2, len(words) * 2, HRES * VRES * 2, out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+
+# Stack Budget
+# 10/19/26
+
+# Pulls The Last util_taskplan Stack Budget Report Out Of A Serial Monitor Log (CONFIG_STACK_BUDGET_ENABLE)
+# & Shows Or Applies The Recommended TASK_STACK_DEPTH_* Values To define_rtos_tasks.h
+# Only The Value In Parentheses Changes. Comments & Defines Not In The Report Are Kept
+# Usage : stack_budget.py <monitor.log> [--write] [define_rtos_tasks.h]
+
+import os
+import re
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.realpath(__file__))
+HEADER_DEFAULT = os.path.join(SCRIPT_DIR, "../src/common/others/defines/include/define_rtos_tasks.h")
+
+MARK_BEGIN = "UTIL_TASKPLAN_STACK_BEGIN"
+MARK_END = "UTIL_TASKPLAN_STACK_END"
+
+RE_REPORT = re.compile(r"#define\s+(TASK_STACK_DEPTH_\w+)\s+\((\d+)\)\s*//\s*(.*)")
+RE_HEADER = re.compile(r"^(#define\s+(TASK_STACK_DEPTH_\w+)\s+)\(([^)]*)\)(.*)$")
+
+
+def report_extract(path):
+    # Last Complete Report In The Log. Returns {define: (value, note)}
+
+    report = {}
+    current = None
+
+    with open(path, "r", errors="replace") as f:
+        for line in f:
+            if MARK_BEGIN in line:
+                current = {}
+                continue
+            if MARK_END in line:
+                if current is not None:
+                    report = current
+                current = None
+                continue
+            if current is None:
+                continue
+            m = RE_REPORT.search(line)
+            if m:
+                current[m.group(1)] = (int(m.group(2)), m.group(3).strip())
+
+    return report
+
+
+def header_apply(path, report, write):
+    # Print Old -> New Per Define & Optionally Rewrite The Header
+
+    with open(path, "r") as f:
+        lines = f.read().split("\n")
+
+    total = 0
+    for i, line in enumerate(lines):
+        m = RE_HEADER.match(line)
+        if not m or m.group(2) not in report:
+            continue
+        value, note = report[m.group(2)]
+        try:
+            old = int(eval(m.group(3), {"__builtins__": {}}))
+        except Exception:
+            old = None
+        if old is not None:
+            total += old - value
+        print("%-35s %7s -> %6u   %s" % (m.group(2), old if old is not None else m.group(3), value, note))
+        lines[i] = "%s(%u)%s" % (m.group(1), value, m.group(4))
+
+    print("Saved %+d B (Once Per Define, Multiply Task Families By Their Instance Count)" % total)
+
+    if write:
+        with open(path, "w") as f:
+            f.write("\n".join(lines))
+        print("Written %s" % path)
+
+
+def main():
+    args = [a for a in sys.argv[1:] if a != "--write"]
+    write = "--write" in sys.argv[1:]
+    if not args:
+        sys.stderr.write("Usage : stack_budget.py <monitor.log> [--write] [define_rtos_tasks.h]\n")
+        sys.exit(1)
+
+    report = report_extract(args[0])
+    if not report:
+        sys.stderr.write("No Complete %s ... %s Block In %s\n" % (MARK_BEGIN, MARK_END, args[0]))
+        sys.exit(1)
+
+    header_apply(args[1] if len(args) > 1 else HEADER_DEFAULT, report, write)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+
+# Trace Extract
+# 10/19/26
+
+# Pulls The util_trace Export Out Of A Serial Monitor Log (CONFIG_TRACE_ENABLE)
+# Writes A Chrome Trace File (Open In ui.perfetto.dev Or chrome://tracing)
+# & Prints The Per Hop Latency Of Every Message Chain Ending In An Lcd Flush
+# Usage : trace_extract.py <monitor.log> [trace.json]
+
+import json
+import sys
+from collections import defaultdict
+
+MARK_BEGIN = "UTIL_TRACE_JSON_BEGIN"
+MARK_END = "UTIL_TRACE_JSON_END"
+
+
+def events_extract(path):
+    # Json Event Lines Between The Markers. Lines Mangled By Interleaved Logs Are Skipped
+
+    events = []
+    skipped = 0
+    inside = False
+
+    with open(path, "r", errors="replace") as f:
+        for line in f:
+            if MARK_BEGIN in line:
+                events = []
+                inside = True
+                continue
+            if MARK_END in line:
+                inside = False
+                continue
+            if not inside:
+                continue
+            line = line.strip()
+            if not line.startswith("{"):
+                continue
+            try:
+                events.append(json.loads(line))
+            except ValueError:
+                skipped += 1
+
+    return events, skipped
+
+
+def chains_build(events, threads):
+    # Group Events By Trace Id Into Ordered Hops
+
+    chains = defaultdict(list)
+    open_slices = {}
+
+    for e in events:
+        ph = e.get("ph")
+        tid = e.get("tid", 0)
+        if ph == "B":
+            open_slices[tid] = e
+            continue
+        if ph == "E":
+            b = open_slices.pop(tid, None)
+            if b and b["args"]["id"]:
+                chains[b["args"]["id"]].append((b["ts"], "%s @%s" % (b["name"], threads.get(tid, tid)), e["ts"] - b["ts"]))
+            continue
+        if ph in ("i", "X") and e.get("args", {}).get("id"):
+            chains[e["args"]["id"]].append((e["ts"], "%s @%s" % (e["name"], threads.get(tid, tid)), None))
+
+    for hops in chains.values():
+        hops.sort(key=lambda h: h[0])
+
+    return chains
+
+
+def chains_print(chains):
+    # Latency Of Each Hop Relative To The First Event Of Its Chain
+
+    totals = []
+
+    for trace_id in sorted(chains):
+        hops = chains[trace_id]
+        if not any(h[1].startswith("flush") for h in hops):
+            continue
+        t0 = hops[0][0]
+        parts = []
+        for ts, name, dur in hops:
+            part = "%s +%.1f" % (name, (ts - t0) / 1000.0)
+            if dur is not None:
+                part += " (%.1f)" % (dur / 1000.0)
+            parts.append(part)
+        totals.append((hops[-1][0] - t0) / 1000.0)
+        print("id %5d : %s" % (trace_id, " -> ".join(parts)))
+
+    if totals:
+        totals.sort()
+        print("")
+        print("Chains To Flush %d. Latency ms Min %.1f Median %.1f Max %.1f" % (
+            len(totals), totals[0], totals[len(totals) // 2], totals[-1]))
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.stderr.write("Usage : trace_extract.py <monitor.log> [trace.json]\n")
+        sys.exit(1)
+
+    out = sys.argv[2] if len(sys.argv) > 2 else "trace.json"
+    events, skipped = events_extract(sys.argv[1])
+    if not events:
+        sys.stderr.write("No Trace Export Found\n")
+        sys.exit(1)
+
+    with open(out, "w") as f:
+        json.dump({"traceEvents": events, "displayTimeUnit": "ms"}, f)
+    print("%d Events -> %s (%d Mangled Lines Skipped)" % (len(events), out, skipped))
+
+    threads = {e["tid"]: e["args"]["name"] for e in events if e.get("ph") == "M"}
+    chains_print(chains_build(events, threads))
+
+    for e in events:
+        if e.get("ph") == "C":
+            print("")
+            print("Cpu %% Over Trace : %s" % ", ".join("%s %s" % kv for kv in sorted(e["args"].items(), key=lambda kv: -kv[1])))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,42 @@
+# Ui Render
+# 10/19/26
+
+#!/bin/bash
+
+# Host (Linux) Render Of The SquareLine Ui Against Golden Frames
+# Usage : ui_render.sh [build] [record]
+#   build  : Rebuild Before Running
+#   record : Rewrite golden/*.png From This Run (Review The Diff Before Committing)
+
+# Get The Path Where This Shell Script Is
+SCRIPT_DIR="$(dirname "$(readlink -f "$0")")"
+PROJECT_DIR="$SCRIPT_DIR/../src/projects/test_ui_render"
+
+# Source Color Definitions
+source $SCRIPT_DIR/colors.sh
+
+cd "$PROJECT_DIR" || exit 1
+
+if [ "$1" = "build" ] || [ ! -f build/Test_Ui_Render.elf ]; then
+    printf "${LIGHT_YELLOW}*** build ***${ENDCOLOR}\n"
+    idf.py --preview set-target linux && idf.py build
+    if [ $? -ne 0 ]; then
+        printf "${LIGHT_RED}Build Failed. Exiting!${ENDCOLOR}\n"
+        exit 1
+    fi
+fi
+
+if [ "$1" = "record" ] || [ "$2" = "record" ]; then
+    export UI_RENDER_RECORD=1
+fi
+
+printf "${LIGHT_YELLOW}*** render ***${ENDCOLOR}\n"
+./build/Test_Ui_Render.elf
+RESULT=$?
+
+if [ $RESULT -ne 0 ]; then
+    printf "${LIGHT_RED}Render Failed ($RESULT). Differing Frames In build/ui_render/${ENDCOLOR}\n"
+    exit 1
+fi
+printf "${LIGHT_GREEN}Render Passed${ENDCOLOR}\n"
+exit 0
@@ -1,32 +1,162 @@
 // DRIVER_API
 // JANUARY 1, 2026
 
+#include <stddef.h>
+#include <stdlib.h>
+#include <strings.h>
+
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
 #include "esp_http_client.h"
+#include "esp_timer.h"
 #include "esp_log.h"
-#include "cJSON.h"
+#include "nvs.h"
 
 #include "driver_api.h"
+#include "util_dlog.h"
 #include "define_common_data_types.h"
 #include "define_rtos_tasks.h"
 #include "project_defines.h"
 
 #define DRIVER_API_API_URL_LEN_MAX      (128)
-#define DRIVER_API_RESPONSE_LEN_MAX     (544)
+#define DRIVER_API_JSON_DEPTH_MAX       (8)
+#define DRIVER_API_JSON_PATH_LEN_MAX    (48)
+#define DRIVER_API_JSON_TOKEN_LEN_MAX   (48)
+#define DRIVER_API_CACHE_ETAG_LEN_MAX   (48)
+#define DRIVER_API_CACHE_DATE_LEN_MAX   (32)
+
+// Json Field Table Entry
+// Path Syntax : "key", "object.key", "array[0].key"
+#define DRIVER_API_JSON_FIELD(path, type, s, member)    { path, type, offsetof(s, member), sizeof(((s*)0)->member) }
+
+typedef enum{
+    DRIVER_API_JSON_FIELD_U16 = 0,
+    DRIVER_API_JSON_FIELD_U32,
+    DRIVER_API_JSON_FIELD_I32,
+    DRIVER_API_JSON_FIELD_INT,
+    DRIVER_API_JSON_FIELD_DOUBLE,
+    DRIVER_API_JSON_FIELD_STRING,
+}driver_api_json_field_type_t;
+
+typedef struct{
+    const char* path;
+    driver_api_json_field_type_t type;
+    uint16_t offset;
+    uint16_t size;
+}driver_api_json_field_t;
+
+typedef enum{
+    DRIVER_API_JSON_STATE_VALUE = 0,
+    DRIVER_API_JSON_STATE_KEY,
+    DRIVER_API_JSON_STATE_NEXT,
+    DRIVER_API_JSON_STATE_STRING,
+    DRIVER_API_JSON_STATE_STRING_ESCAPE,
+    DRIVER_API_JSON_STATE_STRING_UNICODE,
+    DRIVER_API_JSON_STATE_LITERAL,
+    DRIVER_API_JSON_STATE_DONE,
+    DRIVER_API_JSON_STATE_ERROR,
+}driver_api_json_state_t;
+
+// Streaming Json Extractor
+// Fed Body Chunks As They Arrive. Keeps Only The Current Path & Token,
+// Values Whose Path Is In The Field Table Are Written Straight To out
+typedef struct{
+    const driver_api_json_field_t* fields;
+    uint8_t fields_count;
+    void* out;
+    uint32_t found_mask;
+    uint32_t bytes;
+    driver_api_json_state_t state;
+    bool string_is_key;
+    uint8_t unicode_left;
+    uint8_t depth;
+    char container[DRIVER_API_JSON_DEPTH_MAX];
+    uint16_t index[DRIVER_API_JSON_DEPTH_MAX];
+    uint8_t path_base[DRIVER_API_JSON_DEPTH_MAX];
+    uint8_t path_len;
+    char path[DRIVER_API_JSON_PATH_LEN_MAX];
+    uint8_t token_len;
+    char token[DRIVER_API_JSON_TOKEN_LEN_MAX];
+}driver_api_json_t;
+
+// Response Cache Entry
+// meta + data Are What Gets Persisted. data Is The Parsed Struct, Not The Raw Body
+typedef struct{
+    uint32_t url_hash;
+    char etag[DRIVER_API_CACHE_ETAG_LEN_MAX];
+    char last_modified[DRIVER_API_CACHE_DATE_LEN_MAX];
+}driver_api_cache_meta_t;
+
+typedef struct{
+    uint32_t ttl_s;
+    bool valid;
+    int64_t expires_us;
+    driver_api_cache_meta_t meta;
+    void* data;
+    uint16_t data_size;
+}driver_api_cache_t;
+
+typedef struct{
+    const char* name;
+    esp_http_client_handle_t handle;
+    bool connected;
+    bool close_pending;
+    char* url;
+    int status;
+    int64_t parse_us;
+    driver_api_json_t json;
+    driver_api_cache_t cache;
+    // Validators Of The Response In Flight. Committed To cache Only On Success
+    char hdr_etag[DRIVER_API_CACHE_ETAG_LEN_MAX];
+    char hdr_last_modified[DRIVER_API_CACHE_DATE_LEN_MAX];
+    int32_t hdr_max_age_s;
+    driver_api_conn_stats_t stats;
+}driver_api_conn_t;
 
 // Extern Variables
 
 // Local Variables
 static rtos_component_type_t s_component_type;
-static char* s_api_url;
-static char* s_response;
-static uint16_t s_response_len;
+static driver_api_conn_t s_conn[DRIVER_API_HOST_MAX];
+static driver_api_weather_info_t s_cache_weather;
+
+// Json Field Tables
+static const driver_api_json_field_t s_json_fields_weather[] = {
+    DRIVER_API_JSON_FIELD("weather[0].id",          DRIVER_API_JSON_FIELD_U16,      driver_api_weather_info_t, weather_id),
+    DRIVER_API_JSON_FIELD("weather[0].main",        DRIVER_API_JSON_FIELD_STRING,   driver_api_weather_info_t, weather_main),
+    DRIVER_API_JSON_FIELD("weather[0].description", DRIVER_API_JSON_FIELD_STRING,   driver_api_weather_info_t, weather_description),
+    DRIVER_API_JSON_FIELD("weather[0].icon",        DRIVER_API_JSON_FIELD_STRING,   driver_api_weather_info_t, weather_icon),
+    DRIVER_API_JSON_FIELD("main.temp",              DRIVER_API_JSON_FIELD_DOUBLE,   driver_api_weather_info_t, temp),
+    DRIVER_API_JSON_FIELD("main.humidity",          DRIVER_API_JSON_FIELD_INT,      driver_api_weather_info_t, humidity),
+    DRIVER_API_JSON_FIELD("sys.sunrise",            DRIVER_API_JSON_FIELD_U32,      driver_api_weather_info_t, sunrise),
+    DRIVER_API_JSON_FIELD("sys.sunset",             DRIVER_API_JSON_FIELD_U32,      driver_api_weather_info_t, sunset),
+};
+static const driver_api_json_field_t s_json_fields_time[] = {
+    DRIVER_API_JSON_FIELD("timestamp",              DRIVER_API_JSON_FIELD_U32,      driver_api_time_info_t, timestamp),
+    DRIVER_API_JSON_FIELD("gmtOffset",              DRIVER_API_JSON_FIELD_I32,      driver_api_time_info_t, gmt_offset),
+};
 
 // Local Functions
-static void s_ts_to_time_strings(uint32_t ts, driver_api_time_info_t* t_info);
+static bool s_request(driver_api_host_t host);
 static esp_err_t s_http_event_handler(esp_http_client_event_t *evt);
+static void s_json_begin(driver_api_json_t* j, const driver_api_json_field_t* fields, uint8_t fields_count, void* out);
+static void s_json_reset(driver_api_json_t* j);
+static bool s_json_complete(driver_api_json_t* j);
+static void s_json_feed(driver_api_json_t* j, const char* data, int len);
+static void s_json_push(driver_api_json_t* j, char container);
+static void s_json_pop(driver_api_json_t* j);
+static void s_json_path_set(driver_api_json_t* j, const char* key);
+static void s_json_token_add(driver_api_json_t* j, char ch);
+static void s_json_value(driver_api_json_t* j, bool is_string);
+static uint32_t s_cache_url_hash(const char* url);
+static bool s_cache_match(driver_api_conn_t* c);
+static bool s_cache_fresh(driver_api_conn_t* c);
+static void s_cache_refresh(driver_api_conn_t* c);
+static void s_cache_store(driver_api_conn_t* c, const void* data);
+static void s_cache_load(driver_api_conn_t* c);
+static void s_cache_save(driver_api_conn_t* c);
+static void s_header_cache_control(driver_api_conn_t* c, const char* value);
 
 // External Functions
 bool DRIVER_API_Init(void)
@@ -35,11 +165,25 @@ bool DRIVER_API_Init(void)
 
     s_component_type = COMPONENT_TYPE_NON_TASK;
 
-    // Allocate API Url & Response Buffers
-    s_response = (char*)malloc(DRIVER_API_RESPONSE_LEN_MAX);
-    assert(s_response);
-    s_api_url = (char*)malloc(DRIVER_API_API_URL_LEN_MAX);
-    assert(s_api_url);
+    // Connections Are Opened On First Request
+    memset(s_conn, 0, sizeof(s_conn));
+    s_conn[DRIVER_API_HOST_WEATHER].name = "weather";
+    s_conn[DRIVER_API_HOST_TIME].name = "time";
+
+    // Response Cache
+    s_conn[DRIVER_API_HOST_WEATHER].cache.ttl_s = DRIVER_API_WEATHER_TTL_S;
+    s_conn[DRIVER_API_HOST_WEATHER].cache.data = &s_cache_weather;
+    s_conn[DRIVER_API_HOST_WEATHER].cache.data_size = sizeof(s_cache_weather);
+    s_conn[DRIVER_API_HOST_TIME].cache.ttl_s = DRIVER_API_TIME_TTL_S;
+    s_cache_load(&s_conn[DRIVER_API_HOST_WEATHER]);
+
+    // Allocate API Url Buffers
+    // Per Host So Requests To Different Hosts Can Run Concurrently
+    // Responses Are Parsed While Streaming In. No Response Buffer
+    for(uint8_t i = 0; i < DRIVER_API_HOST_MAX; i++){
+        s_conn[i].url = (char*)malloc(DRIVER_API_API_URL_LEN_MAX);
+        assert(s_conn[i].url);
+    }
 
     ESP_LOGI(DEBUG_TAG_DRIVER_API, "Type %u. Init", s_component_type);
 
@@ -49,224 +193,756 @@ bool DRIVER_API_Init(void)
 bool DRIVER_API_GetWeather(driver_api_weather_info_t* w_info)
 {
     // Get Weather Data
+    // Safe To Call Concurrently With DRIVER_API_GetTime (Different Host)
+
+    driver_api_conn_t* c = &s_conn[DRIVER_API_HOST_WEATHER];
+    driver_api_weather_info_t info = {0};
 
-    esp_err_t err;
-    
     // Generate API Call Message
-    // Allocate Buffers & Api Url
-    s_response_len = 0;
-    memset(s_response, 0, DRIVER_API_RESPONSE_LEN_MAX);
-    sprintf(s_api_url, 
+    sprintf(c->url, 
         DRIVER_API_WEATHER_URL_FORMAT,
         DRIVER_API_WEATHER_CITYNAME,
         DRIVER_API_WEATHER_APIKEY
     );
 
-    esp_http_client_config_t config = {
-        .url = s_api_url,
-        .method = HTTP_METHOD_GET,
-        .event_handler = s_http_event_handler,
-        .timeout_ms = 5000,
-    };
-    esp_http_client_handle_t client = esp_http_client_init(&config);
-
-    ESP_LOGI(DEBUG_TAG_DRIVER_API, "Request: %s", s_api_url);
-    ESP_LOGI(DEBUG_TAG_DRIVER_API, "Sending GET request");
-
-    err = esp_http_client_perform(client);
-    if(err != ESP_OK){
-        ESP_LOGE(DEBUG_TAG_DRIVER_API, "Request failed: %s", esp_err_to_name(err));
-        goto cleanup;
+    // Fresh Cache Entry. No Request
+    if(s_cache_fresh(c)){
+        c->stats.cache_hits += 1;
+        *w_info = s_cache_weather;
+        return true;
     }
 
-    // ESP_LOGI(DEBUG_TAG_DRIVER_API, "Response: %s", s_response);
+    // Parse Into A Local Copy So A Failed Request Leaves w_info Untouched
+    s_json_begin(&c->json, s_json_fields_weather, sizeof(s_json_fields_weather) / sizeof(s_json_fields_weather[0]), &info);
 
-    // Response JSON Parsing
-    cJSON* root = cJSON_Parse(s_response);
-    if(!root){
-        ESP_LOGE(DEBUG_TAG_DRIVER_API, "Invalid JSON");
-        goto cleanup;
-    }
-
-    // Weather Array
-    cJSON* weather = cJSON_GetObjectItem(root, "weather");
-    if(cJSON_IsArray(weather)){
-        cJSON* item = cJSON_GetArrayItem(weather, 0);
-        if(cJSON_IsObject(item)){
-            cJSON* id = cJSON_GetObjectItem(item, "id");
-            cJSON* main = cJSON_GetObjectItem(item, "main");
-            cJSON* desc = cJSON_GetObjectItem(item, "description");
-            cJSON* icon = cJSON_GetObjectItem(item, "icon");
-
-            if(cJSON_IsNumber(id) && cJSON_IsString(main) && cJSON_IsString(desc) && cJSON_IsString(icon)){
-                ESP_LOGI(DEBUG_TAG_DRIVER_API, "id: %u", id->valueint);
-                ESP_LOGI(DEBUG_TAG_DRIVER_API, "main: %s", main->valuestring);
-                ESP_LOGI(DEBUG_TAG_DRIVER_API, "id: %s", desc->valuestring);
-                ESP_LOGI(DEBUG_TAG_DRIVER_API, "icon: %s", icon->valuestring);
-
-                w_info->weather_id = id->valueint;
-                strcpy(w_info->weather_main, main->valuestring);
-                strcpy(w_info->weather_description, desc->valuestring);
-                strcpy(w_info->weather_icon, icon->valuestring);
-            }
-        }
+    if(!s_request(DRIVER_API_HOST_WEATHER)){
+        return false;
     }
 
-    // Main Weather Values
-    cJSON* main = cJSON_GetObjectItem(root, "main");
-    if(cJSON_IsObject(main)){
-        cJSON *temp = cJSON_GetObjectItem(main, "temp");
-        cJSON *humidity = cJSON_GetObjectItem(main, "humidity");
-
-        if (cJSON_IsNumber(temp) && cJSON_IsNumber(humidity)){
-            ESP_LOGI(DEBUG_TAG_DRIVER_API, "temperature: %.2f", temp->valuedouble);
-            ESP_LOGI(DEBUG_TAG_DRIVER_API, "humidity: %d", humidity->valueint);
-
-            w_info->temp = temp->valuedouble;
-            w_info->humidity = humidity->valueint;
+    // Cached Copy Is Still Current. Only Usable If There Is One For This Url
+    if(c->status == 304){
+        if(!s_cache_match(c)){
+            ESP_LOGE(DEBUG_TAG_DRIVER_API, "Not Modified Without Cached Copy");
+            return false;
         }
+        s_cache_refresh(c);
+        *w_info = s_cache_weather;
+        return true;
     }
 
-    // Sunrise / Sunset
-    cJSON* sys = cJSON_GetObjectItem(root, "sys");
-    if(cJSON_IsObject(sys)){
-        cJSON *sunrise = cJSON_GetObjectItem(sys, "sunrise");
-        cJSON *sunset = cJSON_GetObjectItem(sys, "sunset");
+    if(!s_json_complete(&c->json)){
+        ESP_LOGE(DEBUG_TAG_DRIVER_API, "Invalid JSON");
+        return false;
+    }
 
-        if(cJSON_IsNumber(sunrise) && cJSON_IsNumber(sunset)){
-            ESP_LOGI(DEBUG_TAG_DRIVER_API, "sunrise: %ld", (long)sunrise->valueint);
-            ESP_LOGI(DEBUG_TAG_DRIVER_API, "sunset: %ld", (long)sunset->valueint);
+    s_cache_store(c, &info);
 
-            w_info->sunrise = (long)sunrise->valueint;
-            w_info->sunset = (long)sunset->valueint;
-        }
-    }
+    // Strings Live In The Local info, So They Go Out Now In One Line. Numbers Are Deferred
+    // Temperature As Centi Degrees (Deferred Args Are 32 Bit, No Floats)
+    ESP_LOGI(DEBUG_TAG_DRIVER_API, "main: %s, description: %s, icon: %s", info.weather_main, info.weather_description, info.weather_icon);
+    UTIL_DLOGI(DEBUG_TAG_DRIVER_API, "id: %u, temperature: %" PRId32 " (x0.01), humidity: %d", info.weather_id, (int32_t)(info.temp * 100), info.humidity);
+    UTIL_DLOGI(DEBUG_TAG_DRIVER_API, "sunrise: %" PRIu32 ", sunset: %" PRIu32, info.sunrise, info.sunset);
 
-    cJSON_Delete(root);
-    esp_http_client_cleanup(client);
+    *w_info = info;
     return true;
-
-    cleanup:
-        esp_http_client_cleanup(client);
-        ESP_LOGI(DEBUG_TAG_DRIVER_API, "HTTP task finished");
-        return false;
 }
 
 bool DRIVER_API_GetTime(driver_api_time_info_t* t_info)
 {
     // Get Time Data
+    // Safe To Call Concurrently With DRIVER_API_GetWeather (Different Host)
 
-    esp_err_t err;
+    driver_api_conn_t* c = &s_conn[DRIVER_API_HOST_TIME];
+    driver_api_time_info_t info = {0};
 
-    s_response_len = 0;
-    memset(s_response, 0, DRIVER_API_RESPONSE_LEN_MAX);
-    sprintf(s_api_url, 
+    sprintf(c->url, 
         DRIVER_API_TIME_URL_FORMAT,
         DRIVER_API_TIME_APIKEY,
         DRIVER_API_TIME_ZONE
     );
 
-    esp_http_client_config_t config = {
-        .url = s_api_url,
-        .method = HTTP_METHOD_GET,
-        .event_handler = s_http_event_handler,
-        .timeout_ms = 5000,
-    };
-    esp_http_client_handle_t client = esp_http_client_init(&config);
-
-    ESP_LOGI(DEBUG_TAG_DRIVER_API, "Request: %s", s_api_url);
-    ESP_LOGI(DEBUG_TAG_DRIVER_API, "Sending GET request");
+    s_json_begin(&c->json, s_json_fields_time, sizeof(s_json_fields_time) / sizeof(s_json_fields_time[0]), &info);
 
-    err = esp_http_client_perform(client);
-    if(err != ESP_OK){
-        ESP_LOGE(DEBUG_TAG_DRIVER_API, "Request failed: %s", esp_err_to_name(err));
-        goto cleanup;
+    if(!s_request(DRIVER_API_HOST_TIME)){
+        return false;
     }
 
-    // ESP_LOGI(DEBUG_TAG_DRIVER_API, "Response: %s", s_response);
+    // No Cache & No Validators Sent, So Nothing To Fall Back On
+    if(c->status == 304){
+        ESP_LOGE(DEBUG_TAG_DRIVER_API, "Not Modified Without Cached Copy");
+        return false;
+    }
 
-    // Response JSON Parsing
-    cJSON* root = cJSON_Parse(s_response);
-    if(!root){
+    if(!s_json_complete(&c->json)){
         ESP_LOGE(DEBUG_TAG_DRIVER_API, "Invalid JSON");
-        goto cleanup;
+        return false;
     }
 
-    // Timestamp
-    cJSON* ts = cJSON_GetObjectItem(root, "timestamp");
-    if(cJSON_IsNumber(ts)){
-        ESP_LOGI(DEBUG_TAG_DRIVER_API, "timestamp: %ld", (long)ts->valueint);
-        
-        t_info->timestamp = (long)ts->valueint;
-        s_ts_to_time_strings(ts->valueint, t_info);
+    // Api Timestamp Is Local Time. Return Utc + Offset
+    info.timestamp -= info.gmt_offset;
+
+    UTIL_DLOGI(DEBUG_TAG_DRIVER_API, "timestamp: %" PRIu32 ", gmt offset: %" PRId32, info.timestamp, info.gmt_offset);
+
+    // Formatting Is Left To The Clock
+    *t_info = info;
+    return true;
+}
 
-        ESP_LOGI(DEBUG_TAG_DRIVER_API, "Time String: %s", t_info->time_string);
-        ESP_LOGI(DEBUG_TAG_DRIVER_API, "AM_PM String: %s", t_info->am_pm_string);
-        ESP_LOGI(DEBUG_TAG_DRIVER_API, "Date String: %s", t_info->date_string);
+bool DRIVER_API_GetWeatherCached(driver_api_weather_info_t* w_info)
+{
+    // Get Last Good Weather Without A Request, Even If Expired
+    // Restored From Nvs On Init. False If There Is None For The Current Url
+
+    driver_api_conn_t* c = &s_conn[DRIVER_API_HOST_WEATHER];
+    char url[DRIVER_API_API_URL_LEN_MAX];
+
+    sprintf(url,
+        DRIVER_API_WEATHER_URL_FORMAT,
+        DRIVER_API_WEATHER_CITYNAME,
+        DRIVER_API_WEATHER_APIKEY
+    );
+    if(!c->cache.valid || c->cache.meta.url_hash != s_cache_url_hash(url)){
+        return false;
     }
 
-    cJSON_Delete(root);
-    esp_http_client_cleanup(client);
+    *w_info = s_cache_weather;
+
     return true;
+}
+
+bool DRIVER_API_GetConnStats(driver_api_host_t host, driver_api_conn_stats_t* stats)
+{
+    // Get Connection Counters Of Api Host
 
-    cleanup:
-        esp_http_client_cleanup(client);
-        ESP_LOGI(DEBUG_TAG_DRIVER_API, "HTTP task finished");
+    if(host >= DRIVER_API_HOST_MAX){
         return false;
+    }
+
+    *stats = s_conn[host].stats;
+
+    return true;
 }
 
-static void s_ts_to_time_strings(uint32_t ts, driver_api_time_info_t* t_info)
+void DRIVER_API_PrintConnStats(void)
 {
-    // Convert Unix Timestamp To Time Components
-
-    time_t rawtime = (time_t)ts;
-    struct tm timeinfo;
-    char wday[7][16] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
-    char month[12][16] = {"January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December"};
-
-    gmtime_r(&rawtime, &timeinfo);
-    memset(t_info->time_string, 0, 16);
-    memset(t_info->am_pm_string, 0, 3);
-    memset(t_info->date_string, 0, 48);
-    t_info->timestamp = ts;
-    if(timeinfo.tm_hour > 12){
-        timeinfo.tm_hour -= 12;
-        sprintf(t_info->am_pm_string, "PM");
-    }else{
-        sprintf(t_info->am_pm_string, "AM");
-    }
-    sprintf(t_info->time_string, "%u:%02u", timeinfo.tm_hour, timeinfo.tm_min);    
-    sprintf(t_info->date_string, 
-                "%s %u %s, %u", 
-                wday[timeinfo.tm_wday],
-                timeinfo.tm_mday,
-                month[timeinfo.tm_mon],
-                timeinfo.tm_year + 1900
+    // Print Connection Counters Of All Api Hosts
+
+    driver_api_conn_stats_t* st;
+
+    for(uint8_t i = 0; i < DRIVER_API_HOST_MAX; i++){
+        st = &s_conn[i].stats;
+        ESP_LOGI(DEBUG_TAG_DRIVER_API, "%-8s Req %" PRIu32 " Hit %" PRIu32 " 304 %" PRIu32 " Connect %" PRIu32 " Reuse %" PRIu32 " Reconnect %" PRIu32 " Fail %" PRIu32 " Latency %" PRIu32 "/%" PRIu32 " ms",
+            s_conn[i].name,
+            st->requests,
+            st->cache_hits,
+            st->not_modified,
+            st->connects,
+            st->reuses,
+            st->reconnects,
+            st->failures,
+            st->latency_last_ms,
+            st->latency_max_ms
+        );
+    }
+}
+
+void DRIVER_API_CloseAll(void)
+{
+    // Release All Api Host Connections
+    // Call When The Network Goes Down. Next Request Reconnects
+    // Deferred To The Requesting Task So A Request In Flight Keeps Its Client
+
+    for(uint8_t i = 0; i < DRIVER_API_HOST_MAX; i++){
+        s_conn[i].close_pending = true;
+    }
+}
+
+static bool s_request(driver_api_host_t host)
+{
+    // Get Host Url Over The Persistent Connection Of Host. Body Streams Into The Host Json Extractor
+    // A Failed Attempt Drops The Socket (Server May Have Closed It While Idle) & Retries Once On A New One
+
+    driver_api_conn_t* c = &s_conn[host];
+    esp_err_t err = ESP_FAIL;
+    int64_t time_start;
+    uint32_t latency_ms;
+
+    // Drop Connection Released By DRIVER_API_CloseAll
+    if(c->close_pending){
+        c->close_pending = false;
+        if(c->handle){
+            esp_http_client_cleanup(c->handle);
+            c->handle = NULL;
+        }
+    }
+
+    // Open Persistent Client On First Use Or After A Hard Failure
+    if(!c->handle){
+        esp_http_client_config_t config = {
+            .url = c->url,
+            .method = HTTP_METHOD_GET,
+            .event_handler = s_http_event_handler,
+            .user_data = (void*)c,
+            .timeout_ms = DRIVER_API_HTTP_TIMEOUT_MS,
+            .keep_alive_enable = true,
+        };
+        c->handle = esp_http_client_init(&config);
+        if(!c->handle){
+            c->stats.failures += 1;
+            return false;
+        }
+    }
+
+    // Conditional Request When A Validator Is Cached For This Url
+    esp_http_client_delete_header(c->handle, "If-None-Match");
+    esp_http_client_delete_header(c->handle, "If-Modified-Since");
+    if(s_cache_match(c)){
+        if(c->cache.meta.etag[0] != '\0'){
+            esp_http_client_set_header(c->handle, "If-None-Match", c->cache.meta.etag);
+        }
+        if(c->cache.meta.last_modified[0] != '\0'){
+            esp_http_client_set_header(c->handle, "If-Modified-Since", c->cache.meta.last_modified);
+        }
+    }
+
+    ESP_LOGI(DEBUG_TAG_DRIVER_API, "Request: %s", c->url);
+
+    c->stats.requests += 1;
+    time_start = esp_timer_get_time();
+
+    for(uint8_t attempt = 0; attempt < DRIVER_API_HTTP_ATTEMPTS_MAX; attempt++){
+        s_json_reset(&c->json);
+        c->parse_us = 0;
+        c->connected = false;
+        c->hdr_etag[0] = '\0';
+        c->hdr_last_modified[0] = '\0';
+        c->hdr_max_age_s = -1;
+
+        // Same Host. Connection Is Kept Open Across The Url Change
+        esp_http_client_set_url(c->handle, c->url);
+        err = esp_http_client_perform(c->handle);
+        if(err == ESP_OK){
+            break;
+        }
+
+        ESP_LOGW(DEBUG_TAG_DRIVER_API, "Request failed: %s. Attempt %u", esp_err_to_name(err), attempt + 1);
+        esp_http_client_close(c->handle);
+        if(attempt + 1 < DRIVER_API_HTTP_ATTEMPTS_MAX){
+            c->stats.reconnects += 1;
+        }
+    }
+
+    latency_ms = (uint32_t)((esp_timer_get_time() - time_start) / 1000);
+    c->stats.latency_last_ms = latency_ms;
+    c->stats.body_bytes_last = c->json.bytes;
+    c->stats.parse_us_last = (uint32_t)c->parse_us;
+    if(latency_ms > c->stats.latency_max_ms){
+        c->stats.latency_max_ms = latency_ms;
+    }
+
+    if(err != ESP_OK){
+        // Start From A Fresh Client (And Dns Lookup) Next Time
+        esp_http_client_cleanup(c->handle);
+        c->handle = NULL;
+        c->stats.failures += 1;
+        return false;
+    }
+
+    if(!c->connected){
+        c->stats.reuses += 1;
+    }
+
+    c->status = esp_http_client_get_status_code(c->handle);
+    if(c->status == 304){
+        c->stats.not_modified += 1;
+    }
+
+    ESP_LOGI(DEBUG_TAG_DRIVER_API, "Response %d. %" PRIu32 " ms, %s Connection",
+        c->status,
+        latency_ms,
+        c->connected ? "New" : "Reused"
     );
+
+    // Error Bodies Are Never Parsed Into Data. 304 Is Resolved By The Caller Against Its Cache
+    if((c->status < 200 || c->status >= 300) && c->status != 304){
+        ESP_LOGE(DEBUG_TAG_DRIVER_API, "%s Http Status %d", c->name, c->status);
+        c->stats.failures += 1;
+        return false;
+    }
+
+    return true;
 }
 
 static esp_err_t s_http_event_handler(esp_http_client_event_t *evt)
 {
     // Http Event Handler
 
+    driver_api_conn_t* c = (driver_api_conn_t*)evt->user_data;
+
     switch(evt->event_id){
+        case HTTP_EVENT_ON_CONNECTED:
+            // New Tcp Connection. Not Raised When A Kept-Alive Socket Is Reused
+            c->connected = true;
+            c->stats.connects += 1;
+            break;
+
+        case HTTP_EVENT_ON_HEADER:
+            // Cache Validators & Lifetime
+            if(strcasecmp(evt->header_key, "ETag") == 0){
+                snprintf(c->hdr_etag, sizeof(c->hdr_etag), "%s", evt->header_value);
+            }else if(strcasecmp(evt->header_key, "Last-Modified") == 0){
+                snprintf(c->hdr_last_modified, sizeof(c->hdr_last_modified), "%s", evt->header_value);
+            }else if(strcasecmp(evt->header_key, "Cache-Control") == 0){
+                s_header_cache_control(c, evt->header_value);
+            }
+            break;
+
         case HTTP_EVENT_ON_DATA:
+            // Parse Chunk In Place. Response Length Is Unbounded
             if(evt->data_len > 0){
-                if(s_response_len + evt->data_len < DRIVER_API_RESPONSE_LEN_MAX){
-                    memcpy(s_response + s_response_len, evt->data, evt->data_len);
-                    s_response_len += evt->data_len;
-                }
+                int64_t t = esp_timer_get_time();
+                s_json_feed(&c->json, (const char*)evt->data, evt->data_len);
+                c->parse_us += esp_timer_get_time() - t;
             }
             break;
         
-        case HTTP_EVENT_ON_FINISH:
-            // Null-terminate Response
-            s_response[s_response_len] = '\0';
-            break;
-        
         default:
             break;
     };
 
     return ESP_OK;
-}
\ No newline at end of file
+}
+
+static void s_json_begin(driver_api_json_t* j, const driver_api_json_field_t* fields, uint8_t fields_count, void* out)
+{
+    // Attach Field Table & Output Struct To Extractor
+
+    j->fields = fields;
+    j->fields_count = fields_count;
+    j->out = out;
+    s_json_reset(j);
+}
+
+static void s_json_reset(driver_api_json_t* j)
+{
+    // Reset Extractor For A New Document
+
+    j->found_mask = 0;
+    j->bytes = 0;
+    j->state = DRIVER_API_JSON_STATE_VALUE;
+    j->depth = 0;
+    j->path_len = 0;
+    j->path[0] = '\0';
+    j->token_len = 0;
+}
+
+static bool s_json_complete(driver_api_json_t* j)
+{
+    // Document Closed & Every Table Field Found
+
+    ESP_LOGI(DEBUG_TAG_DRIVER_API, "Json %" PRIu32 " B. Fields %u/%u",
+        j->bytes,
+        __builtin_popcount(j->found_mask),
+        j->fields_count
+    );
+
+    return (j->state == DRIVER_API_JSON_STATE_DONE) && (j->found_mask == ((1UL << j->fields_count) - 1));
+}
+
+static void s_json_feed(driver_api_json_t* j, const char* data, int len)
+{
+    // Feed Body Chunk
+    // Values May Be Split Across Chunks. Only Path & Token Survive Between Calls
+
+    char ch;
+
+    j->bytes += len;
+
+    for(int i = 0; i < len; i++){
+        ch = data[i];
+
+        if(j->state == DRIVER_API_JSON_STATE_STRING){
+            if(ch == '"'){
+                j->token[j->token_len] = '\0';
+                if(j->string_is_key){
+                    s_json_path_set(j, j->token);
+                    j->state = DRIVER_API_JSON_STATE_VALUE;
+                }else{
+                    s_json_value(j, true);
+                    j->state = DRIVER_API_JSON_STATE_NEXT;
+                }
+            }else if(ch == '\\'){
+                j->state = DRIVER_API_JSON_STATE_STRING_ESCAPE;
+            }else{
+                s_json_token_add(j, ch);
+            }
+            continue;
+        }
+
+        if(j->state == DRIVER_API_JSON_STATE_STRING_ESCAPE){
+            j->state = DRIVER_API_JSON_STATE_STRING;
+            switch(ch){
+                case 'n': s_json_token_add(j, '\n'); break;
+                case 't': s_json_token_add(j, '\t'); break;
+                case 'r': s_json_token_add(j, '\r'); break;
+                case 'b': s_json_token_add(j, '\b'); break;
+                case 'f': s_json_token_add(j, '\f'); break;
+                case 'u':
+                    // Non Ascii Code Point. Shown As '?'
+                    s_json_token_add(j, '?');
+                    j->unicode_left = 4;
+                    j->state = DRIVER_API_JSON_STATE_STRING_UNICODE;
+                    break;
+                default: s_json_token_add(j, ch); break;
+            }
+            continue;
+        }
+
+        if(j->state == DRIVER_API_JSON_STATE_STRING_UNICODE){
+            j->unicode_left -= 1;
+            if(j->unicode_left == 0){
+                j->state = DRIVER_API_JSON_STATE_STRING;
+            }
+            continue;
+        }
+
+        if(j->state == DRIVER_API_JSON_STATE_LITERAL){
+            if(ch != ',' && ch != '}' && ch != ']' && ch != ' ' && ch != '\t' && ch != '\r' && ch != '\n'){
+                s_json_token_add(j, ch);
+                continue;
+            }
+            // Delimiter Ends The Literal & Is Then Handled Below
+            j->token[j->token_len] = '\0';
+            s_json_value(j, false);
+            j->state = DRIVER_API_JSON_STATE_NEXT;
+        }
+
+        if(j->state >= DRIVER_API_JSON_STATE_DONE){
+            return;
+        }
+
+        switch(ch){
+            case ' ':
+            case '\t':
+            case '\r':
+            case '\n':
+            case ':':
+                break;
+
+            case '{':
+                s_json_push(j, '{');
+                break;
+
+            case '[':
+                s_json_push(j, '[');
+                break;
+
+            case '}':
+            case ']':
+                s_json_pop(j);
+                break;
+
+            case ',':
+                if(j->depth == 0){
+                    j->state = DRIVER_API_JSON_STATE_ERROR;
+                }else if(j->container[j->depth - 1] == '['){
+                    j->index[j->depth - 1] += 1;
+                    s_json_path_set(j, NULL);
+                    j->state = DRIVER_API_JSON_STATE_VALUE;
+                }else{
+                    j->state = DRIVER_API_JSON_STATE_KEY;
+                }
+                break;
+
+            case '"':
+                j->string_is_key = (j->state == DRIVER_API_JSON_STATE_KEY);
+                j->token_len = 0;
+                j->state = DRIVER_API_JSON_STATE_STRING;
+                break;
+
+            default:
+                // Number, true, false, null
+                j->token_len = 0;
+                s_json_token_add(j, ch);
+                j->state = DRIVER_API_JSON_STATE_LITERAL;
+                break;
+        }
+    }
+}
+
+static void s_json_push(driver_api_json_t* j, char container)
+{
+    // Enter Object / Array
+
+    if(j->depth >= DRIVER_API_JSON_DEPTH_MAX){
+        j->state = DRIVER_API_JSON_STATE_ERROR;
+        return;
+    }
+
+    j->container[j->depth] = container;
+    j->index[j->depth] = 0;
+    j->path_base[j->depth] = j->path_len;
+    j->depth += 1;
+
+    if(container == '['){
+        s_json_path_set(j, NULL);
+        j->state = DRIVER_API_JSON_STATE_VALUE;
+    }else{
+        j->state = DRIVER_API_JSON_STATE_KEY;
+    }
+}
+
+static void s_json_pop(driver_api_json_t* j)
+{
+    // Leave Object / Array
+
+    if(j->depth == 0){
+        j->state = DRIVER_API_JSON_STATE_ERROR;
+        return;
+    }
+
+    j->depth -= 1;
+    j->path_len = j->path_base[j->depth];
+    j->path[j->path_len] = '\0';
+    j->state = (j->depth == 0) ? DRIVER_API_JSON_STATE_DONE : DRIVER_API_JSON_STATE_NEXT;
+}
+
+static void s_json_path_set(driver_api_json_t* j, const char* key)
+{
+    // Set Last Path Element To Object Key Or (key == NULL) Array Index
+
+    uint8_t base;
+    int n;
+
+    if(j->depth == 0){
+        return;
+    }
+
+    base = j->path_base[j->depth - 1];
+    if(key){
+        n = snprintf(j->path + base, DRIVER_API_JSON_PATH_LEN_MAX - base, "%s%s", (base > 0) ? "." : "", key);
+    }else{
+        n = snprintf(j->path + base, DRIVER_API_JSON_PATH_LEN_MAX - base, "[%u]", j->index[j->depth - 1]);
+    }
+
+    // Overlong Path. Mark So It Matches No Table Entry
+    if(n < 0 || (base + n) >= (DRIVER_API_JSON_PATH_LEN_MAX - 1)){
+        j->path_len = DRIVER_API_JSON_PATH_LEN_MAX - 1;
+        j->path[DRIVER_API_JSON_PATH_LEN_MAX - 2] = '~';
+        j->path[DRIVER_API_JSON_PATH_LEN_MAX - 1] = '\0';
+        return;
+    }
+
+    j->path_len = base + n;
+}
+
+static void s_json_token_add(driver_api_json_t* j, char ch)
+{
+    // Append To Current Token. Excess Is Dropped
+
+    if(j->token_len < (DRIVER_API_JSON_TOKEN_LEN_MAX - 1)){
+        j->token[j->token_len] = ch;
+        j->token_len += 1;
+    }
+}
+
+static void s_json_value(driver_api_json_t* j, bool is_string)
+{
+    // Store Completed Value If Its Path Is In The Field Table
+
+    const driver_api_json_field_t* f;
+    uint8_t* dst;
+
+    for(uint8_t i = 0; i < j->fields_count; i++){
+        f = &j->fields[i];
+        if(strcmp(f->path, j->path) != 0){
+            continue;
+        }
+
+        // Type Mismatch Leaves The Field Unfound
+        if(is_string != (f->type == DRIVER_API_JSON_FIELD_STRING)){
+            return;
+        }
+
+        dst = (uint8_t*)j->out + f->offset;
+        switch(f->type){
+            case DRIVER_API_JSON_FIELD_U16:
+                *(uint16_t*)dst = (uint16_t)strtoul(j->token, NULL, 10);
+                break;
+
+            case DRIVER_API_JSON_FIELD_U32:
+                *(uint32_t*)dst = (uint32_t)strtoul(j->token, NULL, 10);
+                break;
+
+            case DRIVER_API_JSON_FIELD_I32:
+                *(int32_t*)dst = (int32_t)strtol(j->token, NULL, 10);
+                break;
+
+            case DRIVER_API_JSON_FIELD_INT:
+                *(int*)dst = (int)strtol(j->token, NULL, 10);
+                break;
+
+            case DRIVER_API_JSON_FIELD_DOUBLE:
+                *(double*)dst = strtod(j->token, NULL);
+                break;
+
+            case DRIVER_API_JSON_FIELD_STRING:
+                snprintf((char*)dst, f->size, "%s", j->token);
+                break;
+        }
+
+        j->found_mask |= (1UL << i);
+        return;
+    }
+}
+
+static uint32_t s_cache_url_hash(const char* url)
+{
+    // Fnv-1a Hash Of Url. Cache Key
+
+    uint32_t hash = 2166136261UL;
+
+    while(*url){
+        hash ^= (uint8_t)*url++;
+        hash *= 16777619UL;
+    }
+
+    return hash;
+}
+
+static bool s_cache_match(driver_api_conn_t* c)
+{
+    // Cache Entry Holds Data For The Current Url (Fresh Or Not)
+
+    return c->cache.valid && c->cache.meta.url_hash == s_cache_url_hash(c->url);
+}
+
+static bool s_cache_fresh(driver_api_conn_t* c)
+{
+    // Cache Entry Matches Current Url & Has Not Expired
+
+    return s_cache_match(c) && esp_timer_get_time() < c->cache.expires_us;
+}
+
+static void s_cache_refresh(driver_api_conn_t* c)
+{
+    // Restart Cache Entry Lifetime
+    // Server max-age Wins Over The Endpoint Ttl
+
+    uint32_t ttl_s = (c->hdr_max_age_s >= 0) ? (uint32_t)c->hdr_max_age_s : c->cache.ttl_s;
+
+    c->cache.expires_us = esp_timer_get_time() + (int64_t)ttl_s * 1000000;
+
+    // A 304 May Carry Updated Validators
+    if(c->hdr_etag[0] != '\0'){
+        strcpy(c->cache.meta.etag, c->hdr_etag);
+    }
+    if(c->hdr_last_modified[0] != '\0'){
+        strcpy(c->cache.meta.last_modified, c->hdr_last_modified);
+    }
+
+    ESP_LOGI(DEBUG_TAG_DRIVER_API, "%s Cache Ttl %" PRIu32 " s", c->name, ttl_s);
+}
+
+static void s_cache_store(driver_api_conn_t* c, const void* data)
+{
+    // Store Parsed Response
+    // Persisted Only When Content Or Validators Changed, To Spare Flash
+
+    bool changed;
+
+    if(!c->cache.data){
+        return;
+    }
+
+    changed = !c->cache.valid ||
+                memcmp(c->cache.data, data, c->cache.data_size) != 0 ||
+                strcmp(c->cache.meta.etag, c->hdr_etag) != 0 ||
+                strcmp(c->cache.meta.last_modified, c->hdr_last_modified) != 0;
+
+    memcpy(c->cache.data, data, c->cache.data_size);
+    c->cache.meta.url_hash = s_cache_url_hash(c->url);
+    strcpy(c->cache.meta.etag, c->hdr_etag);
+    strcpy(c->cache.meta.last_modified, c->hdr_last_modified);
+    c->cache.valid = true;
+    s_cache_refresh(c);
+
+    if(changed){
+        s_cache_save(c);
+    }
+}
+
+static void s_cache_load(driver_api_conn_t* c)
+{
+    // Restore Persisted Cache Entry
+    // Loaded As Expired. First Request Revalidates It
+
+    nvs_handle_t handle;
+    char key[16];
+    size_t len;
+    bool ok;
+
+    if(nvs_open(DRIVER_API_CACHE_NVS_NAMESPACE, NVS_READONLY, &handle) != ESP_OK){
+        return;
+    }
+
+    sprintf(key, "%.8s.m", c->name);
+    len = sizeof(c->cache.meta);
+    ok = (nvs_get_blob(handle, key, &c->cache.meta, &len) == ESP_OK) && (len == sizeof(c->cache.meta));
+    sprintf(key, "%.8s.d", c->name);
+    len = c->cache.data_size;
+    ok = ok && (nvs_get_blob(handle, key, c->cache.data, &len) == ESP_OK) && (len == c->cache.data_size);
+    nvs_close(handle);
+
+    // Size Mismatch = Struct Changed Since It Was Saved
+    if(!ok){
+        memset(&c->cache.meta, 0, sizeof(c->cache.meta));
+        memset(c->cache.data, 0, c->cache.data_size);
+        return;
+    }
+
+    c->cache.valid = true;
+    c->cache.expires_us = 0;
+
+    ESP_LOGI(DEBUG_TAG_DRIVER_API, "%s Cache Restored", c->name);
+}
+
+static void s_cache_save(driver_api_conn_t* c)
+{
+    // Persist Cache Entry
+
+    nvs_handle_t handle;
+    char key[16];
+
+    if(nvs_open(DRIVER_API_CACHE_NVS_NAMESPACE, NVS_READWRITE, &handle) != ESP_OK){
+        ESP_LOGW(DEBUG_TAG_DRIVER_API, "Cache Nvs Open Fail");
+        return;
+    }
+
+    sprintf(key, "%.8s.m", c->name);
+    nvs_set_blob(handle, key, &c->cache.meta, sizeof(c->cache.meta));
+    sprintf(key, "%.8s.d", c->name);
+    nvs_set_blob(handle, key, c->cache.data, c->cache.data_size);
+    nvs_commit(handle);
+    nvs_close(handle);
+
+    ESP_LOGI(DEBUG_TAG_DRIVER_API, "%s Cache Saved", c->name);
+}
+
+static void s_header_cache_control(driver_api_conn_t* c, const char* value)
+{
+    // Parse Cache-Control
+    // no-store / no-cache -> Revalidate Every Time, max-age=N -> Ttl N
+
+    const char* p;
+
+    if(strstr(value, "no-store") || strstr(value, "no-cache")){
+        c->hdr_max_age_s = 0;
+        return;
+    }
+
+    p = strstr(value, "max-age=");
+    if(p){
+        c->hdr_max_age_s = (int32_t)strtol(p + strlen("max-age="), NULL, 10);
+    }
+}
@@ -11,17 +11,60 @@
 
 #include "util_dataqueue.h"
 
+// Url Bases Can Be Overridden At Build Time (Host Replay Harness : projects/test_api_replay)
+#ifndef DRIVER_API_WEATHER_URL_BASE
+#define DRIVER_API_WEATHER_URL_BASE         "http://api.openweathermap.org"
+#endif
+#ifndef DRIVER_API_TIME_URL_BASE
+#define DRIVER_API_TIME_URL_BASE            "http://api.timezonedb.com"
+#endif
+
 // Weather Api - Openweather (https://home.openweathermap.org/)
-#define DRIVER_API_WEATHER_URL_FORMAT       "http://api.openweathermap.org/data/2.5/weather?q=%s&appid=%s&units=metric"
+#define DRIVER_API_WEATHER_URL_FORMAT       DRIVER_API_WEATHER_URL_BASE "/data/2.5/weather?q=%s&appid=%s&units=metric"
 #define DRIVER_API_WEATHER_CITYNAME         "Bengaluru"
 #define DRIVER_API_WEATHER_COUNTRYCODE      "IN"
 #define DRIVER_API_WEATHER_APIKEY           "302f94ec7416e369eea2c09309bfa098"
 
 // Time Api - Timezonedb (https://timezonedb.com/)
-#define DRIVER_API_TIME_URL_FORMAT          "http://api.timezonedb.com/v2.1/get-time-zone?key=%s&format=json&by=zone&zone=%s"
+#define DRIVER_API_TIME_URL_FORMAT          DRIVER_API_TIME_URL_BASE "/v2.1/get-time-zone?key=%s&format=json&by=zone&zone=%s"
 #define DRIVER_API_TIME_ZONE                "Asia/Kolkata"
+#define DRIVER_API_TIME_ZONE_GMT_OFFSET_S   (5 * 3600 + 1800)   // Offset Of DRIVER_API_TIME_ZONE Until The Api Has Answered
 #define DRIVER_API_TIME_APIKEY              "EQ26WOQQQD91"
 
+// Response Cache
+// Ttl Applies When The Server Sends No Cache-Control max-age. 0 = Never Cached
+// Last Good Weather Is Kept In Nvs So A Reboot Paints Real Data Before The Network Is Up
+#ifndef DRIVER_API_WEATHER_TTL_S
+#define DRIVER_API_WEATHER_TTL_S            (600)
+#endif
+#define DRIVER_API_TIME_TTL_S               (0)
+#define DRIVER_API_CACHE_NVS_NAMESPACE      "driver_api"
+
+// Http Connection
+// One Persistent (Keep-Alive) Client Per Api Host
+#define DRIVER_API_HTTP_TIMEOUT_MS          (5000)
+#define DRIVER_API_HTTP_ATTEMPTS_MAX        (2)
+
+typedef enum{
+    DRIVER_API_HOST_WEATHER = 0,
+    DRIVER_API_HOST_TIME,
+    DRIVER_API_HOST_MAX
+}driver_api_host_t;
+
+typedef struct{
+    uint32_t requests;
+    uint32_t connects;
+    uint32_t reuses;
+    uint32_t reconnects;
+    uint32_t failures;
+    uint32_t cache_hits;
+    uint32_t not_modified;
+    uint32_t latency_last_ms;
+    uint32_t latency_max_ms;
+    uint32_t body_bytes_last;
+    uint32_t parse_us_last;
+}driver_api_conn_stats_t;
+
 typedef struct{
     uint16_t weather_id;
     char weather_main[16];
@@ -33,16 +76,20 @@ typedef struct{
     uint32_t sunset;
 }driver_api_weather_info_t;
 
+// timestamp Is Utc. Layout Mirrors util_dataqueue_timedata_t
 typedef struct{
     uint32_t timestamp;
-    char time_string[16];
-    char am_pm_string[3];
-    char date_string[48];
+    int32_t gmt_offset;
 }driver_api_time_info_t;
 
 bool DRIVER_API_Init(void);
 
 bool DRIVER_API_GetWeather(driver_api_weather_info_t* w_info);
 bool DRIVER_API_GetTime(driver_api_time_info_t* t_info);
+bool DRIVER_API_GetWeatherCached(driver_api_weather_info_t* w_info);
+
+bool DRIVER_API_GetConnStats(driver_api_host_t host, driver_api_conn_stats_t* stats);
+void DRIVER_API_PrintConnStats(void);
+void DRIVER_API_CloseAll(void);
 
 #endif
\ No newline at end of file
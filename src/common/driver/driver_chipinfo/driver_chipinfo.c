@@ -1,14 +1,42 @@
 // DRIVER_CHIPINFO
 // AUGUST 26, 2025
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
 #include "driver_chipinfo.h"
 #include "define_common_data_types.h"
 #include "define_rtos_tasks.h"
 
 // Local Variables
 static rtos_component_type_t s_component_type;
+static esp_timer_handle_t s_timer_mem;
+static uint32_t s_mem_free_last[DRIVER_CHIPINFO_HEAP_MAX];
+static const uint32_t s_heap_caps[DRIVER_CHIPINFO_HEAP_MAX] = {
+    MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+    MALLOC_CAP_DMA,
+    MALLOC_CAP_SPIRAM
+};
+static const char* s_heap_names[DRIVER_CHIPINFO_HEAP_MAX] = {"INTERNAL", "DMA", "SPIRAM"};
+static const uint32_t s_heap_warn_largest[DRIVER_CHIPINFO_HEAP_MAX] = {
+    DRIVER_CHIPINFO_MEM_WARN_LARGEST_INTERNAL,
+    DRIVER_CHIPINFO_MEM_WARN_LARGEST_DMA,
+    DRIVER_CHIPINFO_MEM_WARN_LARGEST_SPIRAM
+};
+static bool s_heap_low[DRIVER_CHIPINFO_HEAP_MAX];
+static driver_chipinfo_task_stack_t s_stack_warned[DRIVER_CHIPINFO_MEM_TASKS_MAX];     // Lowest Warned Free Per Task
+static uint8_t s_stack_warned_count;
 
 // Local Functions
+static void s_timer_mem_cb(void* arg);
+static bool s_stack_warn_new(const driver_chipinfo_task_stack_t* t);
 
 // External Functions
 bool DRIVER_CHIPINFO_Init(void)
@@ -59,6 +87,209 @@ uint32_t DRIVER_CHIPINFO_GetFlashSizeBytes(void)
 uint32_t DRIVER_CHIPINFO_GetRamSizeBytes(void)
 {
     // Return Chip RAM Size In Bytes
+    // Heap Capable Ram (Internal + Psram). Excludes Static Data & Cache Reserved Regions
+
+    return heap_caps_get_total_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT) + heap_caps_get_total_size(MALLOC_CAP_SPIRAM);
+}
+
+bool DRIVER_CHIPINFO_GetHeapStats(driver_chipinfo_heap_t heap, driver_chipinfo_heap_stats_t* stats)
+{
+    // Return Live Heap Figures For One Capability
+
+    multi_heap_info_t info;
+
+    if(heap >= DRIVER_CHIPINFO_HEAP_MAX){
+        return false;
+    }
+
+    memset(stats, 0, sizeof(driver_chipinfo_heap_stats_t));
+    stats->total = heap_caps_get_total_size(s_heap_caps[heap]);
+    if(stats->total == 0){
+        return false;
+    }
+
+    heap_caps_get_info(&info, s_heap_caps[heap]);
+    stats->free = info.total_free_bytes;
+    stats->free_min = info.minimum_free_bytes;
+    stats->largest_block = info.largest_free_block;
+    if(stats->free > 0){
+        stats->frag_percent = 100 - (uint8_t)(((uint64_t)stats->largest_block * 100) / stats->free);
+    }
+
+    return true;
+}
 
+uint8_t DRIVER_CHIPINFO_GetTaskStacks(driver_chipinfo_task_stack_t* stacks, uint8_t max)
+{
+    // Return Stack High Water Mark Of Every Task
+    // Returns Number Of Entries Filled
+
+#if defined(CONFIG_FREERTOS_USE_TRACE_FACILITY)
+    TaskStatus_t* status;
+    UBaseType_t count;
+    BaseType_t core_id;
+    uint8_t n = 0;
+
+    status = (TaskStatus_t*)malloc(DRIVER_CHIPINFO_MEM_TASKS_MAX * sizeof(TaskStatus_t));
+    if(!status){
+        return 0;
+    }
+    count = uxTaskGetSystemState(status, DRIVER_CHIPINFO_MEM_TASKS_MAX, NULL);
+
+    for(UBaseType_t i = 0; i < count && n < max; i++){
+        snprintf(stacks[n].name, sizeof(stacks[n].name), "%s", status[i].pcTaskName);
+        stacks[n].stack_hwm = status[i].usStackHighWaterMark;
+        core_id = xTaskGetCoreID(status[i].xHandle);
+        stacks[n].core = (core_id == tskNO_AFFINITY) ? -1 : (int8_t)core_id;
+        n += 1;
+    }
+
+    free(status);
+    return n;
+#else
+    (void)stacks;
+    (void)max;
     return 0;
+#endif
+}
+
+bool DRIVER_CHIPINFO_MemTelemetryStart(uint32_t period_s)
+{
+    // Start Periodic Memory Sampling
+    // Full Figures Once Now. Samples Only Log Threshold Crossings (Full Line At Debug Level)
+
+    esp_timer_create_args_t args = {
+        .callback = s_timer_mem_cb,
+        .name = "chipinfo-mem"
+    };
+
+    if(s_timer_mem){
+        return false;
+    }
+
+    if(esp_timer_create(&args, &s_timer_mem) != ESP_OK){
+        return false;
+    }
+
+    DRIVER_CHIPINFO_PrintMemStats(true);
+
+    return (esp_timer_start_periodic(s_timer_mem, (uint64_t)period_s * 1000 * 1000) == ESP_OK);
+}
+
+void DRIVER_CHIPINFO_PrintMemStats(bool stacks)
+{
+    // Print Heap Figures Per Capability (Free Delta Since The Previous Print)
+    // stacks : Also Print Task Stack High Water Marks
+
+    driver_chipinfo_heap_stats_t h;
+    driver_chipinfo_task_stack_t* t;
+    uint8_t count;
+
+    for(uint8_t i = 0; i < DRIVER_CHIPINFO_HEAP_MAX; i++){
+        if(!DRIVER_CHIPINFO_GetHeapStats((driver_chipinfo_heap_t)i, &h)){
+            continue;
+        }
+        ESP_LOGI(DEBUG_TAG_DRIVER_CHIPINFO, "%-8s Free %7" PRIu32 " / %7" PRIu32 " (%+6" PRId32 "), Min %7" PRIu32 ", Largest %7" PRIu32 ", Frag %3u %%",
+            s_heap_names[i],
+            h.free,
+            h.total,
+            (s_mem_free_last[i] == 0) ? 0 : (int32_t)(h.free - s_mem_free_last[i]),
+            h.free_min,
+            h.largest_block,
+            h.frag_percent
+        );
+        if(h.largest_block < s_heap_warn_largest[i]){
+            ESP_LOGW(DEBUG_TAG_DRIVER_CHIPINFO, "%s Largest Block %" PRIu32 " < %" PRIu32, s_heap_names[i], h.largest_block, s_heap_warn_largest[i]);
+        }
+        s_mem_free_last[i] = h.free;
+    }
+
+    t = (driver_chipinfo_task_stack_t*)malloc(DRIVER_CHIPINFO_MEM_TASKS_MAX * sizeof(driver_chipinfo_task_stack_t));
+    if(!t){
+        return;
+    }
+    count = DRIVER_CHIPINFO_GetTaskStacks(t, DRIVER_CHIPINFO_MEM_TASKS_MAX);
+
+    for(uint8_t i = 0; i < count; i++){
+        if(stacks){
+            ESP_LOGI(DEBUG_TAG_DRIVER_CHIPINFO, "%-16s Core %2d Stack Free %5" PRIu32 " B", t[i].name, t[i].core, t[i].stack_hwm);
+        }
+        if(t[i].stack_hwm < DRIVER_CHIPINFO_MEM_WARN_STACK_BYTES){
+            ESP_LOGW(DEBUG_TAG_DRIVER_CHIPINFO, "%s Stack Free %" PRIu32 " B", t[i].name, t[i].stack_hwm);
+        }
+    }
+
+    free(t);
+}
+
+static void s_timer_mem_cb(void* arg)
+{
+    // Periodic Memory Sample
+    // esp_timer Task Context. Warns When A Heap Goes Below / Back Above Its Largest Block Threshold
+    // & When A Task Stack Reaches A New Low Under DRIVER_CHIPINFO_MEM_WARN_STACK_BYTES
+
+    driver_chipinfo_heap_stats_t h;
+    driver_chipinfo_task_stack_t* t;
+    uint8_t count;
+    bool low;
+
+    for(uint8_t i = 0; i < DRIVER_CHIPINFO_HEAP_MAX; i++){
+        if(!DRIVER_CHIPINFO_GetHeapStats((driver_chipinfo_heap_t)i, &h)){
+            continue;
+        }
+        ESP_LOGD(DEBUG_TAG_DRIVER_CHIPINFO, "%-8s Free %7" PRIu32 " / %7" PRIu32 ", Min %7" PRIu32 ", Largest %7" PRIu32 ", Frag %3u %%",
+            s_heap_names[i],
+            h.free,
+            h.total,
+            h.free_min,
+            h.largest_block,
+            h.frag_percent
+        );
+
+        low = (h.largest_block < s_heap_warn_largest[i]);
+        if(low && !s_heap_low[i]){
+            ESP_LOGW(DEBUG_TAG_DRIVER_CHIPINFO, "%s Largest Block %" PRIu32 " < %" PRIu32 ". Free %" PRIu32 ", Frag %u %%", s_heap_names[i], h.largest_block, s_heap_warn_largest[i], h.free, h.frag_percent);
+        }else if(!low && s_heap_low[i]){
+            ESP_LOGI(DEBUG_TAG_DRIVER_CHIPINFO, "%s Largest Block %" PRIu32 " Recovered", s_heap_names[i], h.largest_block);
+        }
+        s_heap_low[i] = low;
+    }
+
+    t = (driver_chipinfo_task_stack_t*)malloc(DRIVER_CHIPINFO_MEM_TASKS_MAX * sizeof(driver_chipinfo_task_stack_t));
+    if(!t){
+        return;
+    }
+    count = DRIVER_CHIPINFO_GetTaskStacks(t, DRIVER_CHIPINFO_MEM_TASKS_MAX);
+
+    for(uint8_t i = 0; i < count; i++){
+        if(t[i].stack_hwm < DRIVER_CHIPINFO_MEM_WARN_STACK_BYTES && s_stack_warn_new(&t[i])){
+            ESP_LOGW(DEBUG_TAG_DRIVER_CHIPINFO, "%s Stack Free %" PRIu32 " B", t[i].name, t[i].stack_hwm);
+        }
+    }
+
+    free(t);
+}
+
+static bool s_stack_warn_new(const driver_chipinfo_task_stack_t* t)
+{
+    // Remember The Lowest Warned Stack Free Per Task Name
+    // True When t Is Lower Than Anything Warned Before For That Task
+
+    for(uint8_t i = 0; i < s_stack_warned_count; i++){
+        if(strcmp(s_stack_warned[i].name, t->name) != 0){
+            continue;
+        }
+        if(t->stack_hwm >= s_stack_warned[i].stack_hwm){
+            return false;
+        }
+        s_stack_warned[i].stack_hwm = t->stack_hwm;
+        return true;
+    }
+
+    // Full Table : Keep Warning Rather Than Lose A Task
+    if(s_stack_warned_count < DRIVER_CHIPINFO_MEM_TASKS_MAX){
+        s_stack_warned[s_stack_warned_count++] = *t;
+    }
+
+    return true;
 }
\ No newline at end of file
@@ -9,6 +9,38 @@
 #include "esp_flash.h"
 #include "esp_mac.h"
 
+// Memory Telemetry
+// Heap Figures Are Read Live (One heap_caps_get_info Walk Per Capability)
+// Periodic Samples Only Log Threshold Crossings. DRIVER_CHIPINFO_PrintMemStats Is The Full Dump
+// Task Stacks Need CONFIG_FREERTOS_USE_TRACE_FACILITY
+#define DRIVER_CHIPINFO_MEM_SAMPLE_PERIOD_S         (30)
+#define DRIVER_CHIPINFO_MEM_TASKS_MAX               (24)
+#define DRIVER_CHIPINFO_MEM_WARN_LARGEST_INTERNAL   (8 * 1024)      // Task Stacks (4 KB), Http Client & Wifi Buffers
+#define DRIVER_CHIPINFO_MEM_WARN_LARGEST_DMA        (8 * 1024)      // Bounce Buffers & Gdma Descriptors
+#define DRIVER_CHIPINFO_MEM_WARN_LARGEST_SPIRAM     (96 * 1024)     // Lvgl Draw Buffers (80 KB Each)
+#define DRIVER_CHIPINFO_MEM_WARN_STACK_BYTES        (512)
+
+typedef enum{
+    DRIVER_CHIPINFO_HEAP_INTERNAL = 0,
+    DRIVER_CHIPINFO_HEAP_DMA,
+    DRIVER_CHIPINFO_HEAP_SPIRAM,
+    DRIVER_CHIPINFO_HEAP_MAX
+}driver_chipinfo_heap_t;
+
+typedef struct{
+    uint32_t total;
+    uint32_t free;
+    uint32_t free_min;              // Lowest Free Since Boot
+    uint32_t largest_block;
+    uint8_t frag_percent;           // 100 - Largest Block / Free
+}driver_chipinfo_heap_stats_t;
+
+typedef struct{
+    char name[16];
+    uint32_t stack_hwm;             // Bytes Never Touched Since Task Start
+    int8_t core;                    // -1 : No Affinity
+}driver_chipinfo_task_stack_t;
+
 bool DRIVER_CHIPINFO_Init(void);
 
 bool DRIVER_CHIPINFO_GetChipInfo(esp_chip_info_t *info);
@@ -16,4 +48,9 @@ bool DRIVER_CHIPINFO_GetChipID(uint8_t* val);
 uint32_t DRIVER_CHIPINFO_GetFlashSizeBytes(void);
 uint32_t DRIVER_CHIPINFO_GetRamSizeBytes(void);
 
+bool DRIVER_CHIPINFO_GetHeapStats(driver_chipinfo_heap_t heap, driver_chipinfo_heap_stats_t* stats);
+uint8_t DRIVER_CHIPINFO_GetTaskStacks(driver_chipinfo_task_stack_t* stacks, uint8_t max);
+bool DRIVER_CHIPINFO_MemTelemetryStart(uint32_t period_s);
+void DRIVER_CHIPINFO_PrintMemStats(bool stacks);
+
 #endif
\ No newline at end of file
@@ -1,40 +1,78 @@
 // DRIVER_LCD
 // SEPTEMBER 30, 2025
 
+#include <time.h>
 #include <sys/lock.h>
 #include <sys/param.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
 #include "esp_err.h"
 #include "esp_log.h"
 #include "esp_check.h"
+#include "esp_cache.h"
 #include "esp_idf_version.h"
+#include "esp_async_memcpy.h"
 #include "driver/i2c_master.h"
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_panel_rgb.h"
 #include "lvgl.h"
 #include "display/lv_display.h" 
 #include "lv_demos.h"
+#include "lvgl_private.h"
 
 #include "driver_lcd.h"
 #include "util_dataqueue.h"
+#include "util_trace.h"
+#include "util_boot.h"
+#include "util_dlog.h"
+#include "util_taskplan.h"
 #include "define_common_data_types.h"
 #include "define_rtos_tasks.h"
 #include "bsp.h"
 
-#ifdef CONFIG_INCLUDE_UI
-#include "ui.h"
-#endif
-
 // Display & Frambeuffer Flags
 // Lvgl Refresh Modes (DRIVER_LCD_LVGL_USE_FULL_REFRESH or DRIVER_LCD_LVGL_USE_PARTIAL_REFRESH)
 #define DRIVER_LCD_LVGL_USE_PARTIAL_REFRESH
 // Bounce Buffer
 #define DRIVER_LCD_USE_BOUNCE_BUFFER
+// Gdma Draw Unit For Large Opaque Blits & Fills
+#define DRIVER_LCD_USE_DMA_DRAW
+
+#ifdef DRIVER_LCD_USE_DMA_DRAW
+// Lvgl Draw Unit Id. Any Value Not Used By The Builtin Units
+#define DRIVER_LCD_DMA_UNIT_ID              (90)
+#define DRIVER_LCD_DMA_PREF_SCORE           (50)            // Software Unit Scores 100, Lower Wins
+
+// One Draw Task As A Run Of Transfers. Lvgl Task Only, Except done (Gdma Isr)
+typedef struct{
+    uint8_t* dst;
+    const uint8_t* src;             // NULL : Fill, Every Transfer Reads The Fill Run
+    uint32_t dst_stride;
+    uint32_t src_stride;
+    uint32_t row_bytes;
+    uint32_t rows;
+    uint32_t chunk_bytes;           // Contiguous Area Copied In Chunks Of This. 0 : One Transfer Per Row
+    uint32_t transfers;
+    uint32_t submitted;
+    volatile uint32_t done;
+    uint16_t color;
+    bool failed;
+}driver_lcd_dma_job_t;
+
+typedef struct{
+    lv_draw_unit_t base_unit;
+    lv_draw_task_t* task_act;
+    driver_lcd_dma_job_t job;
+}driver_lcd_dma_unit_t;
+#endif
 
 // Extern Variables
+extern const uint16_t driver_lcd_splash_rle[];
+extern const uint32_t driver_lcd_splash_rle_len;
 
 // Local Variables
 static TaskHandle_t s_handle_task_lvgl;
@@ -43,24 +81,85 @@ static util_dataqueue_t s_dataqueue;
 static esp_lcd_panel_handle_t s_handle_rgb_panel;
 static SemaphoreHandle_t s_handle_semaphore_vsync;
 static SemaphoreHandle_t s_handle_semaphore_guiready;
+static SemaphoreHandle_t s_handle_semaphore_panel_setup;
+static bool s_panel_setup_ok;
 static esp_timer_handle_t s_timer;
 static esp_timer_handle_t s_timer_one_second;
 static lv_display_t* s_lvgl_display;
 
+// Frame Metrics
+// s_frame_cur Is Lvgl Task Only. Ring Is Read From Other Tasks Under s_frame_lock
+static driver_lcd_frame_t s_frame_ring[DRIVER_LCD_FRAME_RING_LEN];
+static driver_lcd_frame_t s_frame_cur;
+static uint32_t s_frame_count;
+static uint32_t s_frame_vsync_late_last;
+static int64_t s_frame_start_us;
+static int64_t s_frame_wait_start_us;
+static int64_t s_frame_log_next_us;
+static portMUX_TYPE s_frame_lock = portMUX_INITIALIZER_UNLOCKED;
+static volatile uint32_t s_vsync_late;
+static int64_t s_vsync_last_us;
+
+// Splash. Lvgl Task Only Once Lvgl Runs
+static bool s_splash_hold;
+static int64_t s_splash_hold_until_us;
+
+// Trace Ids Of Commands Handled Since The Last Flushed Frame (util_trace)
+static uint16_t s_trace_pending[DRIVER_LCD_TRACE_PENDING_MAX];
+static uint8_t s_trace_pending_count;
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+// Lvgl Allocator Counters. Updated In The Lvgl Task, Read Under s_mem_lock
+static driver_lcd_mem_stats_t s_mem_stats;
+static portMUX_TYPE s_mem_lock = portMUX_INITIALIZER_UNLOCKED;
+static const uint32_t s_mem_caps[DRIVER_LCD_MEM_TIER_MAX] = {
+    MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+    MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT
+};
+#endif
+
+#ifdef DRIVER_LCD_USE_DMA_DRAW
+// Dma Draw Unit. Counters Updated In The Lvgl Task, Read Under s_dma_lock
+static async_memcpy_handle_t s_dma_mcp;
+static uint16_t* s_dma_fill_src;
+static driver_lcd_dma_stats_t s_dma_stats;
+static portMUX_TYPE s_dma_lock = portMUX_INITIALIZER_UNLOCKED;
+#endif
 
-// Hacky Code For Second Indicator
-static char s_second_panel_visible = true;
+// Second Indicator. Set By The One Second Timer
 static bool s_update_seconds = false;
 
 // Local Functions
 static bool s_lcd_rgb_panel_setup(void);
+static bool s_lcd_rgb_panel_setup_pinned(void);
+static void s_task_panel_setup(void *arg);
+static void s_splash_paint(void);
+static void s_splash_release(const char* reason);
 static bool s_lvgl_setup(void);
 static void s_task_lvgl(void *arg);
+static void s_frame_push(void);
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+static void* s_mem_alloc(size_t size);
+static void s_mem_account(driver_lcd_mem_tier_t tier, void* p, bool alloc);
+#endif
+static void s_lvgl_event_cb(lv_event_t* e);
 static void s_timer_one_second_cb(void *arg);
 static void s_lvgl_tick_timer_cb(void* arg);
 static bool s_lcd_rgb_panel_vsync_cb(esp_lcd_panel_handle_t panel, const esp_lcd_rgb_panel_event_data_t *event_data, void *user_data);
 static bool s_lcd_rgb_panel_color_trans_cb(esp_lcd_panel_handle_t panel, const esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx);
 static void s_lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map);
+#ifdef DRIVER_LCD_USE_DMA_DRAW
+static bool s_dma_draw_init(void);
+static bool s_dma_ptr_ok(const void* p);
+static bool s_dma_job_prepare(lv_draw_task_t* t, driver_lcd_dma_job_t* job);
+static void s_dma_job_transfer(const driver_lcd_dma_job_t* job, uint32_t i, uint8_t** dst, const uint8_t** src, uint32_t* len);
+static bool s_dma_service(driver_lcd_dma_unit_t* u);
+static void s_dma_finish(driver_lcd_dma_unit_t* u);
+static int32_t s_dma_evaluate_cb(lv_draw_unit_t* draw_unit, lv_draw_task_t* t);
+static int32_t s_dma_dispatch_cb(lv_draw_unit_t* draw_unit, lv_layer_t* layer);
+static int32_t s_dma_delete_cb(lv_draw_unit_t* draw_unit);
+static bool s_dma_done_cb(async_memcpy_handle_t mcp, async_memcpy_event_t* event, void* cb_args);
+#endif
 
 // External Functions
 bool DRIVER_LCD_Init(void)
@@ -69,12 +168,17 @@ bool DRIVER_LCD_Init(void)
 
     s_component_type = COMPONENT_TYPE_TASK;
 
+    // SquareLine Widgets Bound To Commands. Created Later By ui_init
+    DRIVER_LCD_UI_Init();
+
     ESP_LOGI(DEBUG_TAG_DRIVER_LCD, "Type %u. Init", s_component_type);
 
     s_handle_semaphore_vsync = xSemaphoreCreateBinary();
     assert(s_handle_semaphore_vsync);
     s_handle_semaphore_guiready = xSemaphoreCreateBinary();
     assert(s_handle_semaphore_guiready);
+    s_handle_semaphore_panel_setup = xSemaphoreCreateBinary();
+    assert(s_handle_semaphore_panel_setup);
 
     // Create Data Queue
     UTIL_DATAQUEUE_Create(&s_dataqueue, DRIVER_LCD_DATAQUEUE_MAX);
@@ -88,7 +192,7 @@ bool DRIVER_LCD_Init(void)
     ESP_ERROR_CHECK(esp_timer_create(&timer_args, &s_timer_one_second));
 
     // Initialize Display Subsystems
-    if(!s_lcd_rgb_panel_setup()) goto err;
+    if(!s_lcd_rgb_panel_setup_pinned()) goto err;
     if(!s_lvgl_setup()) goto err;
 
     return true;
@@ -109,6 +213,281 @@ bool DRIVER_LCD_AddCommand(util_dataqueue_item_t* dq_i)
     return true;
 }
 
+uint8_t DRIVER_LCD_GetFrames(driver_lcd_frame_t* frames, uint8_t max)
+{
+    // Copy Up To max Most Recent Frames, Oldest First
+    // Returns Number Copied
+
+    uint32_t count;
+    uint32_t first;
+
+    taskENTER_CRITICAL(&s_frame_lock);
+    count = MIN(s_frame_count, MIN((uint32_t)max, DRIVER_LCD_FRAME_RING_LEN));
+    first = s_frame_count - count;
+    for(uint32_t i = 0; i < count; i++){
+        frames[i] = s_frame_ring[(first + i) % DRIVER_LCD_FRAME_RING_LEN];
+    }
+    taskEXIT_CRITICAL(&s_frame_lock);
+
+    return (uint8_t)count;
+}
+
+void DRIVER_LCD_GetFrameStats(driver_lcd_frame_stats_t* stats)
+{
+    // Summarise The Frame Ring
+
+    const driver_lcd_frame_t* f;
+    uint64_t render = 0;
+    uint64_t flush = 0;
+    uint64_t pixels = 0;
+    uint32_t n;
+
+    memset(stats, 0, sizeof(driver_lcd_frame_stats_t));
+
+    taskENTER_CRITICAL(&s_frame_lock);
+    n = MIN(s_frame_count, DRIVER_LCD_FRAME_RING_LEN);
+    stats->frames = s_frame_count;
+    for(uint32_t i = 0; i < n; i++){
+        f = &s_frame_ring[i];
+        render += f->render_us;
+        flush += f->flush_us;
+        pixels += f->pixels;
+        stats->render_us_max = MAX(stats->render_us_max, f->render_us);
+        stats->flush_us_max = MAX(stats->flush_us_max, f->flush_us);
+        stats->areas_max = MAX(stats->areas_max, f->areas);
+        stats->mem_used_max = MAX(stats->mem_used_max, f->mem_used);
+    }
+    taskEXIT_CRITICAL(&s_frame_lock);
+
+    stats->vsync_late = s_vsync_late;
+    stats->window = (uint16_t)n;
+    if(n){
+        stats->render_us_avg = render / n;
+        stats->flush_us_avg = flush / n;
+        stats->pixels_avg = pixels / n;
+    }
+}
+
+void DRIVER_LCD_PrintFrameStats(void)
+{
+    // Print Frame Metrics Summary
+
+    driver_lcd_frame_stats_t st;
+
+    DRIVER_LCD_GetFrameStats(&st);
+
+    ESP_LOGI(DEBUG_TAG_DRIVER_LCD, "Frames %" PRIu32 " (Last %u). Render Avg %" PRIu32 " Max %" PRIu32 " us, Flush Avg %" PRIu32 " Max %" PRIu32 " us, Px Avg %" PRIu32 ", Areas Max %u, Lvgl Mem Max %" PRIu32 " B, Vsync Late %" PRIu32,
+        st.frames,
+        st.window,
+        st.render_us_avg,
+        st.render_us_max,
+        st.flush_us_avg,
+        st.flush_us_max,
+        st.pixels_avg,
+        st.areas_max,
+        st.mem_used_max,
+        st.vsync_late
+    );
+}
+
+bool DRIVER_LCD_GetMemStats(driver_lcd_mem_stats_t* stats)
+{
+    // Copy Lvgl Allocator Tier Counters
+    // False When Lvgl Uses Another Allocator
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+    taskENTER_CRITICAL(&s_mem_lock);
+    *stats = s_mem_stats;
+    taskEXIT_CRITICAL(&s_mem_lock);
+
+    return true;
+#else
+    memset(stats, 0, sizeof(driver_lcd_mem_stats_t));
+
+    return false;
+#endif
+}
+
+void DRIVER_LCD_PrintMemStats(void)
+{
+    // Print Lvgl Allocator Tier Counters
+
+    driver_lcd_mem_stats_t st;
+    const char* names[DRIVER_LCD_MEM_TIER_MAX] = {"Internal", "Psram"};
+
+    if(!DRIVER_LCD_GetMemStats(&st)){
+        return;
+    }
+
+    for(uint8_t i = 0; i < DRIVER_LCD_MEM_TIER_MAX; i++){
+        ESP_LOGI(DEBUG_TAG_DRIVER_LCD, "Lvgl Mem %-8s Used %7" PRIu32 " B (Max %7" PRIu32 " B) In %5" PRIu32 " Blocks, Allocs %" PRIu32 ", Fails %" PRIu32,
+            names[i],
+            st.tier[i].used,
+            st.tier[i].used_max,
+            st.tier[i].blocks,
+            st.tier[i].allocs,
+            st.tier[i].fails
+        );
+    }
+    ESP_LOGI(DEBUG_TAG_DRIVER_LCD, "Lvgl Mem Fallbacks %" PRIu32 ", Internal Budget %u B", st.fallbacks, DRIVER_LCD_MEM_INTERNAL_BUDGET);
+}
+
+bool DRIVER_LCD_GetDmaStats(driver_lcd_dma_stats_t* stats)
+{
+    // Copy Dma Draw Unit Counters
+    // False When The Unit Is Not Running
+
+#ifdef DRIVER_LCD_USE_DMA_DRAW
+    taskENTER_CRITICAL(&s_dma_lock);
+    *stats = s_dma_stats;
+    taskEXIT_CRITICAL(&s_dma_lock);
+
+    return (s_dma_mcp != NULL);
+#else
+    memset(stats, 0, sizeof(driver_lcd_dma_stats_t));
+
+    return false;
+#endif
+}
+
+void DRIVER_LCD_PrintDmaStats(void)
+{
+    // Print Dma Draw Unit Counters
+
+    driver_lcd_dma_stats_t st;
+
+    if(!DRIVER_LCD_GetDmaStats(&st)){
+        return;
+    }
+
+    ESP_LOGI(DEBUG_TAG_DRIVER_LCD, "Dma Draw Fills %" PRIu32 ", Images %" PRIu32 ", Transfers %" PRIu32 ", %" PRIu32 " KB, Cpu Fallbacks %" PRIu32,
+        st.fills,
+        st.images,
+        st.transfers,
+        st.kbytes,
+        st.fallbacks
+    );
+}
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+// Lvgl Stdlib Hooks (LV_STDLIB_CUSTOM)
+// Lvgl Runs With LV_OS_NONE, So These Are Only Called From The Lvgl Task
+void lv_mem_init(void)
+{
+    // Reset Tier Counters
+
+    memset(&s_mem_stats, 0, sizeof(s_mem_stats));
+}
+
+void lv_mem_deinit(void)
+{
+    // Nothing To Release. Blocks Live In The System Heaps
+}
+
+lv_mem_pool_t lv_mem_add_pool(void* mem, size_t bytes)
+{
+    // Extra Pools Not Supported. Tiers Grow From The System Heaps
+
+    return NULL;
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool)
+{
+    // Extra Pools Not Supported
+}
+
+void* lv_malloc_core(size_t size)
+{
+    // Allocate By Size Class
+
+    return s_mem_alloc(size);
+}
+
+void* lv_realloc_core(void* p, size_t new_size)
+{
+    // Resize In Place When The Size Class Is Unchanged, Else Move Across Tiers
+    // Growing An Internal Block Past The Internal Budget Moves It To Psram, Like A Fresh Allocation
+
+    driver_lcd_mem_tier_t tier;
+    driver_lcd_mem_tier_t tier_new;
+    size_t size_old;
+    void* p_new;
+
+    if(p == NULL){
+        return s_mem_alloc(new_size);
+    }
+
+    tier = esp_ptr_external_ram(p) ? DRIVER_LCD_MEM_TIER_PSRAM : DRIVER_LCD_MEM_TIER_INTERNAL;
+    tier_new = (new_size <= DRIVER_LCD_MEM_SMALL_MAX) ? DRIVER_LCD_MEM_TIER_INTERNAL : DRIVER_LCD_MEM_TIER_PSRAM;
+    size_old = heap_caps_get_allocated_size(p);
+
+    if(tier == DRIVER_LCD_MEM_TIER_INTERNAL && tier_new == DRIVER_LCD_MEM_TIER_INTERNAL && new_size > size_old
+        && (s_mem_stats.tier[tier].used - size_old + new_size) > DRIVER_LCD_MEM_INTERNAL_BUDGET){
+        // s_mem_alloc Below Sees The Same Budget & Serves Psram (Counted As A Fallback)
+        tier_new = DRIVER_LCD_MEM_TIER_PSRAM;
+    }
+
+    if(tier == tier_new){
+        s_mem_account(tier, p, false);
+        p_new = heap_caps_realloc(p, new_size, s_mem_caps[tier]);
+        if(p_new){
+            s_mem_account(tier, p_new, true);
+            return p_new;
+        }
+        // Block Untouched On Failure
+        s_mem_account(tier, p, true);
+    }
+
+    p_new = s_mem_alloc(new_size);
+    if(p_new == NULL){
+        return NULL;
+    }
+    memcpy(p_new, p, MIN(size_old, new_size));
+    lv_free_core(p);
+
+    return p_new;
+}
+
+void lv_free_core(void* p)
+{
+    // Free To Owning Tier
+
+    if(p == NULL){
+        return;
+    }
+
+    s_mem_account(esp_ptr_external_ram(p) ? DRIVER_LCD_MEM_TIER_PSRAM : DRIVER_LCD_MEM_TIER_INTERNAL, p, false);
+    heap_caps_free(p);
+}
+
+void lv_mem_monitor_core(lv_mem_monitor_t* mon_p)
+{
+    // Lvgl Heap View Of Both Tiers
+    // Total Is The Internal Budget Plus All Of Psram
+
+    uint32_t used;
+
+    taskENTER_CRITICAL(&s_mem_lock);
+    used = s_mem_stats.tier[DRIVER_LCD_MEM_TIER_INTERNAL].used + s_mem_stats.tier[DRIVER_LCD_MEM_TIER_PSRAM].used;
+    mon_p->used_cnt = s_mem_stats.tier[DRIVER_LCD_MEM_TIER_INTERNAL].blocks + s_mem_stats.tier[DRIVER_LCD_MEM_TIER_PSRAM].blocks;
+    mon_p->max_used = s_mem_stats.tier[DRIVER_LCD_MEM_TIER_INTERNAL].used_max + s_mem_stats.tier[DRIVER_LCD_MEM_TIER_PSRAM].used_max;
+    taskEXIT_CRITICAL(&s_mem_lock);
+
+    mon_p->total_size = DRIVER_LCD_MEM_INTERNAL_BUDGET + heap_caps_get_total_size(s_mem_caps[DRIVER_LCD_MEM_TIER_PSRAM]);
+    mon_p->free_size = (mon_p->total_size > used) ? (mon_p->total_size - used) : 0;
+    mon_p->free_biggest_size = heap_caps_get_largest_free_block(s_mem_caps[DRIVER_LCD_MEM_TIER_PSRAM]);
+    mon_p->used_pct = (uint8_t)(((uint64_t)used * 100) / mon_p->total_size);
+    mon_p->frag_pct = 0;
+}
+
+lv_result_t lv_mem_test_core(void)
+{
+    // System Heap Integrity
+
+    return heap_caps_check_integrity_all(true) ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+#endif
+
 static bool s_lcd_rgb_panel_setup(void)
 {
     // Initialize LCD Panel & RGB
@@ -212,13 +591,116 @@ static bool s_lcd_rgb_panel_setup(void)
         "Esp_lcd Panel Init Fail"
     );
 
-    ESP_LOGI(DEBUG_TAG_DRIVER_LCD, "Lcd Panel Setup Done");
+    // Splash Before Anything Else Touches The Framebuffer
+    s_splash_paint();
+
+    ESP_LOGI(DEBUG_TAG_DRIVER_LCD, "Lcd Panel Setup Done. Core %d", xPortGetCoreID());
     return true;
 
     err:
         return false;
 }
 
+static bool s_lcd_rgb_panel_setup_pinned(void)
+{
+    // Run Panel Setup On TASK_CORE_LCD_PANEL_ISR
+    // esp_lcd Allocates The Rgb Panel Interrupt (Vsync & Bounce Buffer Refill) On The Calling Core
+
+    if(xPortGetCoreID() == TASK_CORE_LCD_PANEL_ISR){
+        return s_lcd_rgb_panel_setup();
+    }
+
+    s_panel_setup_ok = false;
+    if(xTaskCreatePinnedToCore(
+        s_task_panel_setup,
+        "t-lcd-setup",
+        TASK_STACK_DEPTH_LCD_PANEL_SETUP,
+        NULL,
+        TASK_PRIORITY_LVGL,
+        NULL,
+        TASK_CORE_LCD_PANEL_ISR
+    ) != pdPASS){
+        return false;
+    }
+    xSemaphoreTake(s_handle_semaphore_panel_setup, portMAX_DELAY);
+
+    return s_panel_setup_ok;
+}
+
+static void s_task_panel_setup(void *arg)
+{
+    // One Shot Panel Setup Task
+
+    s_panel_setup_ok = s_lcd_rgb_panel_setup();
+    xSemaphoreGive(s_handle_semaphore_panel_setup);
+
+    UTIL_TASKPLAN_StackNote();
+    vTaskDelete(NULL);
+}
+
+static void s_splash_paint(void)
+{
+    // Decode The Splash From Flash Straight Into The Panel Framebuffer(s)
+    // Scan Order, Like Lvgl Flushes (DRIVER_LCD_DISPLAY_ROTATION Moves No Pixels)
+
+    void* fbs[2] = {NULL, NULL};
+    uint16_t* fb;
+    uint32_t px;
+    uint32_t count;
+    uint16_t color;
+    int64_t start = esp_timer_get_time();
+
+    #if defined DRIVER_LCD_LVGL_USE_FULL_REFRESH
+    if(esp_lcd_rgb_panel_get_frame_buffer(s_handle_rgb_panel, 2, &fbs[0], &fbs[1]) != ESP_OK){
+        return;
+    }
+    #endif
+    #if defined DRIVER_LCD_LVGL_USE_PARTIAL_REFRESH
+    if(esp_lcd_rgb_panel_get_frame_buffer(s_handle_rgb_panel, 1, &fbs[0]) != ESP_OK){
+        return;
+    }
+    #endif
+
+    for(uint8_t f = 0; f < 2 && fbs[f]; f++){
+        fb = (uint16_t*)fbs[f];
+        px = 0;
+        for(uint32_t i = 0; i + 1 < driver_lcd_splash_rle_len && px < DRIVER_LCD_DISPLAY_HRES * DRIVER_LCD_DISPLAY_VRES; i += 2){
+            count = MIN((uint32_t)driver_lcd_splash_rle[i], (DRIVER_LCD_DISPLAY_HRES * DRIVER_LCD_DISPLAY_VRES) - px);
+            color = driver_lcd_splash_rle[i + 1];
+            while(count--){
+                fb[px++] = color;
+            }
+        }
+
+        // Psram Framebuffer Is Read By Dma. Write Back The Cache
+        if(esp_cache_msync(fb, DRIVER_LCD_DISPLAY_HRES * DRIVER_LCD_DISPLAY_VRES * sizeof(uint16_t), ESP_CACHE_MSYNC_FLAG_DIR_C2M) != ESP_OK){
+            ESP_LOGW(DEBUG_TAG_DRIVER_LCD, "Splash Cache Sync Fail");
+        }
+    }
+
+    #if defined DRIVER_LCD_LVGL_USE_PARTIAL_REFRESH
+    s_splash_hold = true;
+    s_splash_hold_until_us = esp_timer_get_time() + (DRIVER_LCD_SPLASH_HOLD_MAX_MS * 1000LL);
+    #endif
+
+    ESP_LOGI(DEBUG_TAG_DRIVER_LCD, "Splash Painted In %" PRId64 " us", esp_timer_get_time() - start);
+}
+
+static void s_splash_release(const char* reason)
+{
+    // Hand The Panel Over To Lvgl
+    // Flushes Dropped While Holding Are Redrawn With The Next Refresh
+
+    if(!s_splash_hold){
+        return;
+    }
+
+    s_splash_hold = false;
+    lv_obj_invalidate(lv_screen_active());
+
+    ESP_LOGI(DEBUG_TAG_DRIVER_LCD, "Splash Released (%s)", reason);
+}
+
 static bool s_lvgl_setup(void)
 {
     // Initialize Lvgl Port
@@ -247,9 +729,10 @@ static bool s_lvgl_setup(void)
     #endif
 
     #if defined DRIVER_LCD_LVGL_USE_PARTIAL_REFRESH
-    buf1 = heap_caps_malloc(100 * DRIVER_LCD_DISPLAY_HRES * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
+    // Cache Line Aligned So Full Width Areas Qualify For The Dma Draw Unit
+    buf1 = heap_caps_aligned_alloc(DRIVER_LCD_DMA_ALIGN, 100 * DRIVER_LCD_DISPLAY_HRES * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
     assert(buf1);
-    buf2 = heap_caps_malloc(100 * DRIVER_LCD_DISPLAY_HRES * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
+    buf2 = heap_caps_aligned_alloc(DRIVER_LCD_DMA_ALIGN, 100 * DRIVER_LCD_DISPLAY_HRES * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
     assert(buf2);
     #endif
 
@@ -267,9 +750,13 @@ static bool s_lvgl_setup(void)
     // Set Display Rotation
     // Set Cb Function That Copies Rendered Image To Display Area
     lv_display_set_color_format(s_lvgl_display, LV_COLOR_FORMAT_RGB565);
-    lv_display_set_rotation(s_lvgl_display, LV_DISPLAY_ROTATION_180);
+    lv_display_set_rotation(s_lvgl_display, DRIVER_LCD_DISPLAY_ROTATION);
     lv_display_set_flush_cb(s_lvgl_display, s_lvgl_flush_cb);
 
+    // Frame Metrics
+    lv_display_add_event_cb(s_lvgl_display, s_lvgl_event_cb, LV_EVENT_ALL, NULL);
+    s_frame_log_next_us = esp_timer_get_time() + (DRIVER_LCD_FRAME_LOG_PERIOD_S * 1000000LL);
+
     ESP_LOGI(DEBUG_TAG_DRIVER_LCD, "Lvgl Display Created");
 
     // Lvgl Tick Timer
@@ -281,13 +768,15 @@ static bool s_lvgl_setup(void)
     ESP_ERROR_CHECK(esp_timer_start_periodic(s_timer, DRIVER_LCD_LVGL_TICK_PERIOD_MS * 1000));
 
     // Create Lvgl Task
-    xTaskCreate(
+    // Pinned Next To The Panel Isr, Away From Wifi / Lwip On Core 0
+    xTaskCreatePinnedToCore(
         s_task_lvgl,
         "t-lvgl",
         TASK_STACK_DEPTH_LVGL,
         NULL,
         TASK_PRIORITY_LVGL,
-        &s_handle_task_lvgl
+        &s_handle_task_lvgl,
+        TASK_CORE_LVGL
     );
 
     ESP_LOGI(DEBUG_TAG_DRIVER_LCD, "Lvgl Task Created");
@@ -302,12 +791,22 @@ static void s_task_lvgl(void *arg)
 
     ESP_LOGI(DEBUG_TAG_DRIVER_LCD, "Starting LVGL task");
 
+    // Dma Draw Unit. Installed From Here So Its Gdma Isr Runs On The Lvgl Core
+    #ifdef DRIVER_LCD_USE_DMA_DRAW
+    s_dma_draw_init();
+    #endif
+
     while(true){
         if(UTIL_DATAQUEUE_MessageCheck(&s_dataqueue))
         {
             if(UTIL_DATAQUEUE_MessageGet(&s_dataqueue, &dq_i, 0))
             {
-                ESP_LOGI(DEBUG_TAG_DRIVER_LCD, "New In DataQueue. Type %u, Data %u", dq_i.data_type, dq_i.data);
+                UTIL_DLOGI(DEBUG_TAG_DRIVER_LCD, "New In DataQueue. Type %u, Data %u", dq_i.data_type, dq_i.data);
+
+                UTIL_TRACE_Begin(dq_i.trace_id, "lcd", dq_i.data_type, dq_i.data);
+                if(dq_i.trace_id && s_trace_pending_count < DRIVER_LCD_TRACE_PENDING_MAX){
+                    s_trace_pending[s_trace_pending_count++] = dq_i.trace_id;
+                }
 
                 if(dq_i.data_type == DATA_TYPE_COMMAND)
                 {
@@ -322,78 +821,204 @@ static void s_task_lvgl(void *arg)
                             // 1. Component Config -> LVGL Configuration -> Others -> Show CPU Usage And Fps Count
                             #if defined CONFIG_LV_BUILD_DEMOS && defined CONFIG_LV_USE_SYSMON && defined CONFIG_LV_USE_PERF_MONITOR
                                 ESP_LOGI(DEBUG_TAG_DRIVER_LCD, "Lvgl Demo", s_component_type);
+                                s_splash_release("Demo");
                                 lv_demo_benchmark();
                             #endif
                             break;
                         
                         case DRIVER_LCD_COMMAND_LOAD_UI:
-                            #ifdef CONFIG_INCLUDE_UI
-                            ui_init();
-                            #endif
-                            break;
-                        
-                        case DRIVER_LCD_COMMAND_SET_IP:
-                            #ifdef CONFIG_INCLUDE_UI
-                            lv_label_set_text(ui_ipaddress, dq_i.data_buff.value.ip);
-                            if(dq_i.data_buff.value.ip[0] == '\0'){
-                                lv_img_set_src(ui_imageconnection, &ui_img_images_button_red_png);
-                            }else{
-                                lv_image_set_src(ui_imageconnection, &ui_img_images_button_green_png);
-                            }
-                            #endif
+                            // Widgets Created & Bound In driver_lcd_ui.c
+                            DRIVER_LCD_UI_Command(&dq_i);
+                            UTIL_BOOT_Signal(UTIL_BOOT_READY_UI);
+                            // First Frame Rendered Below Is The Ui
+                            s_splash_release("Ui");
                             break;
 
                         case DRIVER_LCD_COMMAND_SET_TIME:
-                            #ifdef CONFIG_INCLUDE_UI
-                            lv_label_set_text(ui_time, dq_i.data_buff.value.timedata.time_string);
-                            lv_label_set_text(ui_date, dq_i.data_buff.value.timedata.date_string);
-                            lv_label_set_text(ui_ampm, dq_i.data_buff.value.timedata.am_pm_string);
-                            #endif
-                            
+                            DRIVER_LCD_UI_Command(&dq_i);
+
                             // Start One Second Timer If Not Already Running
                             if(!esp_timer_is_active(s_timer_one_second)){
                                 ESP_ERROR_CHECK(esp_timer_start_periodic(s_timer_one_second, 1000 * 1000));
                             }
                             break;
-
-                        case DRIVER_LCD_COMMAND_SET_WEATHER:
-                            #ifdef CONFIG_INCLUDE_UI
-                            lv_label_set_text(ui_labelhumidity, dq_i.data_buff.value.weatherdata.humidity);
-                            lv_label_set_text(uic_labelhtemperature, dq_i.data_buff.value.weatherdata.temp);
-                            #endif
-                            break;
-                        
-                        case DRIVER_LCD_COMMAND_SET_LOCATION:
-                            #ifdef CONFIG_INCLUDE_UI
-                            lv_label_set_text(ui_label1, dq_i.data_buff.value.location);
-                            #endif
-                            break;
                         
                         default:
+                            // Remaining Ui Commands (Ip, Weather, Location)
+                            DRIVER_LCD_UI_Command(&dq_i);
                             break;
                     }
                 }
+
+                UTIL_TRACE_End(dq_i.trace_id, "lcd");
             }
         }
 
-        // Hacky Code For Second Toggling
+        // Second Indicator
         if(s_update_seconds){
-            #ifdef CONFIG_INCLUDE_UI
-            if(s_second_panel_visible){
-                lv_obj_add_flag(ui_panel3, LV_OBJ_FLAG_HIDDEN);
-            }else{
-                lv_obj_clear_flag(ui_panel3, LV_OBJ_FLAG_HIDDEN);
-            }
-            s_second_panel_visible = !s_second_panel_visible;
-            #endif
+            DRIVER_LCD_UI_SecondToggle();
             s_update_seconds = false;
         }
 
+        // Background Preload Step / Theme Switch
+        DRIVER_LCD_UI_Service();
+
+        // No Ui In Time. Show Whatever Lvgl Has
+        if(s_splash_hold && esp_timer_get_time() >= s_splash_hold_until_us){
+            s_splash_release("Timeout");
+        }
+
         lv_timer_handler();
+
+        // Periodic Frame Metrics
+        if(esp_timer_get_time() >= s_frame_log_next_us){
+            s_frame_log_next_us += (DRIVER_LCD_FRAME_LOG_PERIOD_S * 1000000LL);
+            DRIVER_LCD_PrintFrameStats();
+            DRIVER_LCD_PrintMemStats();
+            DRIVER_LCD_PrintDmaStats();
+        }
+
         vTaskDelay(pdMS_TO_TICKS(DRIVER_LCD_LVGL_TASK_PERIOD_MS));
     }
 }
 
+static void s_frame_push(void)
+{
+    // Close Current Frame Into The Ring
+    // Lvgl Task Only
+
+    uint32_t late = s_vsync_late;
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+    // Tier Counters. lv_mem_monitor Would Walk The Psram Heap Every Frame
+    s_frame_cur.mem_used = s_mem_stats.tier[DRIVER_LCD_MEM_TIER_INTERNAL].used + s_mem_stats.tier[DRIVER_LCD_MEM_TIER_PSRAM].used;
+#else
+    lv_mem_monitor_t mon;
+
+    lv_mem_monitor(&mon);
+    s_frame_cur.mem_used = mon.total_size - mon.free_size;
+#endif
+    s_frame_cur.vsync_late = (uint16_t)MIN(late - s_frame_vsync_late_last, UINT16_MAX);
+    s_frame_vsync_late_last = late;
+
+    taskENTER_CRITICAL(&s_frame_lock);
+    s_frame_ring[s_frame_count % DRIVER_LCD_FRAME_RING_LEN] = s_frame_cur;
+    s_frame_count += 1;
+    taskEXIT_CRITICAL(&s_frame_lock);
+
+    // Time To First Pixel
+    if(s_frame_count == 1){
+        UTIL_BOOT_Signal(UTIL_BOOT_READY_FIRST_PIXEL);
+    }
+
+    // End Of The Trace Chains This Frame Puts On Screen
+    for(uint8_t i = 0; i < s_trace_pending_count; i++){
+        UTIL_TRACE_Record(UTIL_TRACE_EVENT_FLUSH, s_trace_pending[i], "flush", NULL, 0, 0);
+    }
+    s_trace_pending_count = 0;
+}
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+static void* s_mem_alloc(size_t size)
+{
+    // Allocate From The Size Class Tier
+    // Small Allocations Spill To Psram Once The Internal Budget Is Used, Either Tier Falls Back To The Other When Full
+
+    driver_lcd_mem_tier_t tier;
+    bool fallback = false;
+    void* p;
+
+    tier = (size <= DRIVER_LCD_MEM_SMALL_MAX) ? DRIVER_LCD_MEM_TIER_INTERNAL : DRIVER_LCD_MEM_TIER_PSRAM;
+    if(tier == DRIVER_LCD_MEM_TIER_INTERNAL && (s_mem_stats.tier[tier].used + size) > DRIVER_LCD_MEM_INTERNAL_BUDGET){
+        tier = DRIVER_LCD_MEM_TIER_PSRAM;
+        fallback = true;
+    }
+
+    p = heap_caps_malloc(size, s_mem_caps[tier]);
+    if(p == NULL){
+        taskENTER_CRITICAL(&s_mem_lock);
+        s_mem_stats.tier[tier].fails += 1;
+        taskEXIT_CRITICAL(&s_mem_lock);
+
+        tier = (tier == DRIVER_LCD_MEM_TIER_INTERNAL) ? DRIVER_LCD_MEM_TIER_PSRAM : DRIVER_LCD_MEM_TIER_INTERNAL;
+        fallback = true;
+        p = heap_caps_malloc(size, s_mem_caps[tier]);
+        if(p == NULL){
+            return NULL;
+        }
+    }
+
+    s_mem_account(tier, p, true);
+    if(fallback){
+        taskENTER_CRITICAL(&s_mem_lock);
+        s_mem_stats.fallbacks += 1;
+        taskEXIT_CRITICAL(&s_mem_lock);
+    }
+
+    return p;
+}
+
+static void s_mem_account(driver_lcd_mem_tier_t tier, void* p, bool alloc)
+{
+    // Update Tier Counters For Block p
+
+    driver_lcd_mem_tier_stats_t* t = &s_mem_stats.tier[tier];
+    uint32_t size = heap_caps_get_allocated_size(p);
+
+    taskENTER_CRITICAL(&s_mem_lock);
+    if(alloc){
+        t->used += size;
+        t->used_max = MAX(t->used_max, t->used);
+        t->blocks += 1;
+        t->allocs += 1;
+    }else{
+        t->used -= MIN(size, t->used);
+        t->blocks -= (t->blocks > 0) ? 1 : 0;
+    }
+    taskEXIT_CRITICAL(&s_mem_lock);
+}
+#endif
+
+static void s_lvgl_event_cb(lv_event_t* e)
+{
+    // Lvgl Display Event Cb
+    // Brackets Each Refresh Cycle For Frame Metrics
+
+    int64_t now;
+    int64_t total;
+
+    switch(lv_event_get_code(e))
+    {
+        case LV_EVENT_REFR_START:
+            s_frame_start_us = esp_timer_get_time();
+            memset(&s_frame_cur, 0, sizeof(s_frame_cur));
+            s_frame_cur.timestamp_ms = (uint32_t)(s_frame_start_us / 1000);
+            break;
+
+        case LV_EVENT_FLUSH_WAIT_START:
+            s_frame_wait_start_us = esp_timer_get_time();
+            break;
+
+        case LV_EVENT_FLUSH_WAIT_FINISH:
+            s_frame_cur.flush_us += (uint32_t)(esp_timer_get_time() - s_frame_wait_start_us);
+            break;
+
+        case LV_EVENT_REFR_READY:
+            // Refresh Cycles With Nothing Invalidated Are Not Frames
+            if(s_frame_cur.areas == 0){
+                break;
+            }
+            now = esp_timer_get_time();
+            total = now - s_frame_start_us - s_frame_cur.flush_us;
+            s_frame_cur.render_us = (total > 0) ? (uint32_t)total : 0;
+            s_frame_push();
+            break;
+
+        default:
+            break;
+    }
+}
+
 static void s_timer_one_second_cb(void *arg)
 {
     // Send One Second Notification
@@ -414,6 +1039,14 @@ static bool s_lcd_rgb_panel_vsync_cb(esp_lcd_panel_handle_t panel, const esp_lcd
     // Esp_lcd Panel Vsync Cb
 
     BaseType_t high_task_awoken = pdFALSE;
+    int64_t now = esp_timer_get_time();
+
+    // Late Vsync. Panel Isr Starved (Bounce Buffer Refill Shares It)
+    if(s_vsync_last_us && (now - s_vsync_last_us) > DRIVER_LCD_FRAME_VSYNC_LATE_US){
+        s_vsync_late += 1;
+        UTIL_DLOGW(DEBUG_TAG_DRIVER_LCD, "Vsync Late. %" PRIu32 " us", (uint32_t)(now - s_vsync_last_us));
+    }
+    s_vsync_last_us = now;
 
     // ESP_EARLY_LOGI(DEBUG_TAG_DRIVER_LCD, "vsync cb");
     xSemaphoreGiveFromISR(s_handle_semaphore_vsync, &high_task_awoken);
@@ -437,8 +1070,18 @@ static void s_lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *
     // Lvgl Flush Cb
     // Pass the Draw Buffer To The Driver
 
+    int64_t start = esp_timer_get_time();
+    int64_t now;
+
+    // Splash Still Up. Drop The Area Without Touching The Panel
+    if(s_splash_hold){
+        lv_display_flush_ready(disp);
+        return;
+    }
+
     // Wait For The VSync Event - With A Timeout
     // Forever Blocking Is Bad
+    // Partial Refresh Never Waits Here. The Wait Counts As Flush Time
     #if defined DRIVER_LCD_LVGL_USE_FULL_REFRESH
     if(xSemaphoreTake(s_handle_semaphore_vsync, pdMS_TO_TICKS(30)) != pdTRUE){
         ESP_LOGW(DEBUG_TAG_DRIVER_LCD, "VSYNC timeout");
@@ -451,5 +1094,329 @@ static void s_lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *
         area->y2 + 1,
         px_map
     );
+    now = esp_timer_get_time();
+    s_frame_cur.flush_us += (uint32_t)(now - start);
+    s_frame_cur.areas += 1;
+    s_frame_cur.pixels += lv_area_get_size(area);
     // lv_display_flush_ready(disp);
-}
\ No newline at end of file
+}
+
+#ifdef DRIVER_LCD_USE_DMA_DRAW
+static bool s_dma_draw_init(void)
+{
+    // Install Async Memcpy & Register The Draw Unit With Lvgl
+    // On Failure Everything Keeps Rendering On The Cpu
+
+    async_memcpy_config_t cfg = ASYNC_MEMCPY_DEFAULT_CONFIG();
+    driver_lcd_dma_unit_t* u;
+
+    cfg.backlog = DRIVER_LCD_DMA_BACKLOG;
+    cfg.dma_burst_size = 32;
+
+    s_dma_fill_src = (uint16_t*)heap_caps_aligned_alloc(DRIVER_LCD_DMA_ALIGN, DRIVER_LCD_DMA_FILL_SRC_BYTES, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    if(!s_dma_fill_src){
+        ESP_LOGW(DEBUG_TAG_DRIVER_LCD, "Dma Draw Fill Run Alloc Fail. Cpu Only");
+        return false;
+    }
+
+    if(esp_async_memcpy_install(&cfg, &s_dma_mcp) != ESP_OK){
+        ESP_LOGW(DEBUG_TAG_DRIVER_LCD, "Dma Draw Async Memcpy Install Fail. Cpu Only");
+        heap_caps_free(s_dma_fill_src);
+        s_dma_fill_src = NULL;
+        s_dma_mcp = NULL;
+        return false;
+    }
+
+    u = lv_draw_create_unit(sizeof(driver_lcd_dma_unit_t));
+    u->base_unit.evaluate_cb = s_dma_evaluate_cb;
+    u->base_unit.dispatch_cb = s_dma_dispatch_cb;
+    u->base_unit.delete_cb = s_dma_delete_cb;
+    u->base_unit.name = "DL_GDMA";
+
+    ESP_LOGI(DEBUG_TAG_DRIVER_LCD, "Dma Draw Unit Ready. Min %u B, Backlog %u", DRIVER_LCD_DMA_MIN_BYTES, DRIVER_LCD_DMA_BACKLOG);
+    return true;
+}
+
+static bool s_dma_ptr_ok(const void* p)
+{
+    // Gdma Readable / Writable Address
+
+#if !CONFIG_SPIRAM_RODATA
+    // Flash Mapped Rodata Shares The External Address Range But Is Not Dma Readable
+    if(esp_ptr_in_drom(p)){
+        return false;
+    }
+#endif
+
+    return esp_ptr_dma_capable(p) || esp_ptr_dma_ext_capable(p);
+}
+
+static bool s_dma_job_prepare(lv_draw_task_t* t, driver_lcd_dma_job_t* job)
+{
+    // Check A Draw Task Can Go To Gdma & Describe Its Transfers
+    // Runs At Evaluate (Task Creation) & Again At Dispatch. The Layer Buffer Is The Same At Both
+
+    lv_layer_t* layer = ((lv_draw_dsc_base_t*)t->draw_dsc)->layer;
+    const lv_draw_fill_dsc_t* fill;
+    const lv_draw_image_dsc_t* img;
+    const lv_image_dsc_t* src;
+    lv_area_t area;
+    uint32_t src_stride;
+    bool contiguous;
+
+    memset(job, 0, sizeof(driver_lcd_dma_job_t));
+
+    // Layers Get Their Buffer Only When First Dispatched, So In Practice This Is The Display Draw Buffer
+    if(!layer || !layer->draw_buf || layer->color_format != LV_COLOR_FORMAT_RGB565 || t->opa < LV_OPA_MAX){
+        return false;
+    }
+    if(!lv_area_intersect(&area, &t->area, &t->clip_area)){
+        return false;
+    }
+
+    switch(t->type){
+        case LV_DRAW_TASK_TYPE_FILL:
+            fill = (const lv_draw_fill_dsc_t*)t->draw_dsc;
+            if(fill->radius != 0 || fill->grad.dir != LV_GRAD_DIR_NONE || fill->opa < LV_OPA_MAX){
+                return false;
+            }
+            job->color = lv_color_to_u16(fill->color);
+            break;
+
+        case LV_DRAW_TASK_TYPE_IMAGE:
+            img = (const lv_draw_image_dsc_t*)t->draw_dsc;
+            if(img->opa < LV_OPA_MAX || img->clip_radius != 0 || img->bitmap_mask_src || img->sup || img->tile ||
+               img->blend_mode != LV_BLEND_MODE_NORMAL || img->recolor_opa > LV_OPA_MIN || img->rotation != 0 ||
+               img->skew_x != 0 || img->skew_y != 0 || img->scale_x != LV_SCALE_NONE || img->scale_y != LV_SCALE_NONE ||
+               lv_image_src_get_type(img->src) != LV_IMAGE_SRC_VARIABLE){
+                return false;
+            }
+            src = (const lv_image_dsc_t*)img->src;
+            if(src->header.cf != LV_COLOR_FORMAT_RGB565 || src->header.w != lv_area_get_width(&t->area) || src->header.h != lv_area_get_height(&t->area)){
+                return false;
+            }
+            src_stride = src->header.stride ? src->header.stride : (src->header.w * sizeof(uint16_t));
+            job->src = src->data + ((area.y1 - t->area.y1) * src_stride) + ((area.x1 - t->area.x1) * sizeof(uint16_t));
+            job->src_stride = src_stride;
+            break;
+
+        default:
+            return false;
+    }
+
+    job->dst = (uint8_t*)lv_draw_layer_go_to_xy(layer, area.x1 - layer->buf_area.x1, area.y1 - layer->buf_area.y1);
+    job->dst_stride = layer->draw_buf->header.stride;
+    job->row_bytes = lv_area_get_width(&area) * sizeof(uint16_t);
+    job->rows = lv_area_get_height(&area);
+
+    if((job->row_bytes * job->rows) < DRIVER_LCD_DMA_MIN_BYTES){
+        return false;
+    }
+
+    // Whole Cache Lines Only
+    if((((uintptr_t)job->dst) | job->dst_stride | job->row_bytes) % DRIVER_LCD_DMA_ALIGN){
+        return false;
+    }
+    if(job->src && ((((uintptr_t)job->src) | job->src_stride) % DRIVER_LCD_DMA_ALIGN)){
+        return false;
+    }
+    if(!s_dma_ptr_ok(job->dst) || (job->src && !s_dma_ptr_ok(job->src))){
+        return false;
+    }
+
+    // Contiguous : Rows Back To Back In Destination (& Source), Copied In Large Chunks
+    // Otherwise One Transfer Per Row, Worth It Only For Wide Rows
+    contiguous = (job->dst_stride == job->row_bytes) && (!job->src || job->src_stride == job->row_bytes);
+    if(contiguous){
+        job->chunk_bytes = job->src ? DRIVER_LCD_DMA_CHUNK_BYTES : DRIVER_LCD_DMA_FILL_SRC_BYTES;
+        job->transfers = ((job->row_bytes * job->rows) + job->chunk_bytes - 1) / job->chunk_bytes;
+    }else{
+        if(job->row_bytes < DRIVER_LCD_DMA_ROW_MIN_BYTES || (!job->src && job->row_bytes > DRIVER_LCD_DMA_FILL_SRC_BYTES)){
+            return false;
+        }
+        job->transfers = job->rows;
+    }
+
+    return true;
+}
+
+static void s_dma_job_transfer(const driver_lcd_dma_job_t* job, uint32_t i, uint8_t** dst, const uint8_t** src, uint32_t* len)
+{
+    // Destination, Source & Length Of Transfer i
+
+    uint32_t offset;
+
+    if(job->chunk_bytes){
+        offset = i * job->chunk_bytes;
+        *len = MIN(job->chunk_bytes, (job->row_bytes * job->rows) - offset);
+        *dst = job->dst + offset;
+        *src = job->src ? (job->src + offset) : (const uint8_t*)s_dma_fill_src;
+    }else{
+        *len = job->row_bytes;
+        *dst = job->dst + (i * job->dst_stride);
+        *src = job->src ? (job->src + (i * job->src_stride)) : (const uint8_t*)s_dma_fill_src;
+    }
+}
+
+static bool s_dma_service(driver_lcd_dma_unit_t* u)
+{
+    // Queue Transfers While The Backlog Has Room & Finish The Task Once All Are Done
+    // Returns True When The Unit Is Free Again
+
+    driver_lcd_dma_job_t* job = &u->job;
+    uint8_t* dst;
+    const uint8_t* src;
+    uint32_t len;
+    esp_err_t ret;
+
+    // One Slot Spare. The Driver Recycles A Transfer Just After Its Callback Counted It Done
+    while(!job->failed && job->submitted < job->transfers && (job->submitted - job->done) < (DRIVER_LCD_DMA_BACKLOG - 1)){
+        s_dma_job_transfer(job, job->submitted, &dst, &src, &len);
+
+        // Write Back Dirty Lines So A Later Eviction Cannot Land On Top Of The Copy
+        if(esp_ptr_external_ram(dst)){
+            esp_cache_msync(dst, len, ESP_CACHE_MSYNC_FLAG_DIR_C2M);
+        }
+
+        ret = esp_async_memcpy(s_dma_mcp, dst, (void*)src, len, s_dma_done_cb, u);
+        if(ret != ESP_OK){
+            job->failed = true;
+            break;
+        }
+        job->submitted += 1;
+    }
+
+    if(job->done != job->submitted || (!job->failed && job->submitted < job->transfers)){
+        return false;
+    }
+
+    s_dma_finish(u);
+    return true;
+}
+
+static void s_dma_finish(driver_lcd_dma_unit_t* u)
+{
+    // Complete The Draw Task
+    // Refused Transfer : Redraw The Whole Task On The Cpu. Opaque, So Any Partial Copy Is Overwritten
+
+    driver_lcd_dma_job_t* job = &u->job;
+    lv_draw_task_t* t = u->task_act;
+    uint8_t* dst;
+    const uint8_t* src;
+    uint32_t len;
+
+    if(job->failed){
+        if(t->type == LV_DRAW_TASK_TYPE_FILL){
+            lv_draw_sw_fill(t, (lv_draw_fill_dsc_t*)t->draw_dsc, &t->area);
+        }else{
+            lv_draw_sw_image(t, (const lv_draw_image_dsc_t*)t->draw_dsc, &t->area);
+        }
+    }else if(esp_ptr_external_ram(job->dst)){
+        // Drop Stale Lines So The Cpu Sees The Copied Pixels
+        for(uint32_t i = 0; i < job->transfers; i++){
+            s_dma_job_transfer(job, i, &dst, &src, &len);
+            esp_cache_msync(dst, len, ESP_CACHE_MSYNC_FLAG_DIR_M2C);
+        }
+    }
+
+    taskENTER_CRITICAL(&s_dma_lock);
+    if(job->failed){
+        s_dma_stats.fallbacks += 1;
+    }else{
+        if(job->src){
+            s_dma_stats.images += 1;
+        }else{
+            s_dma_stats.fills += 1;
+        }
+        s_dma_stats.transfers += job->transfers;
+        s_dma_stats.kbytes += (job->row_bytes * job->rows) / 1024;
+    }
+    taskEXIT_CRITICAL(&s_dma_lock);
+
+    t->state = LV_DRAW_TASK_STATE_FINISHED;
+    u->task_act = NULL;
+    lv_draw_dispatch_request();
+}
+
+static int32_t s_dma_evaluate_cb(lv_draw_unit_t* draw_unit, lv_draw_task_t* t)
+{
+    // Lvgl Evaluate. Claim Eligible Fills & Image Blits
+
+    driver_lcd_dma_job_t job;
+
+    (void)draw_unit;
+
+    if(t->preference_score <= DRIVER_LCD_DMA_PREF_SCORE || !s_dma_job_prepare(t, &job)){
+        return 0;
+    }
+
+    t->preference_score = DRIVER_LCD_DMA_PREF_SCORE;
+    t->preferred_draw_unit_id = DRIVER_LCD_DMA_UNIT_ID;
+
+    return 1;
+}
+
+static int32_t s_dma_dispatch_cb(lv_draw_unit_t* draw_unit, lv_layer_t* layer)
+{
+    // Lvgl Dispatch. Polled From The Refresh Loop (LV_OS_NONE Has No Completion Signal)
+    // Reports Idle While Busy So Lvgl Keeps Polling. The Software Unit Meanwhile Takes Independent Tasks
+
+    driver_lcd_dma_unit_t* u = (driver_lcd_dma_unit_t*)draw_unit;
+    driver_lcd_dma_job_t* job = &u->job;
+    lv_draw_task_t* t;
+    uint32_t n;
+
+    if(u->task_act && !s_dma_service(u)){
+        return LV_DRAW_UNIT_IDLE;
+    }
+
+    t = lv_draw_get_available_task(layer, NULL, DRIVER_LCD_DMA_UNIT_ID);
+    if(!t || t->preferred_draw_unit_id != DRIVER_LCD_DMA_UNIT_ID){
+        return LV_DRAW_UNIT_IDLE;
+    }
+    if(!lv_draw_layer_alloc_buf(layer)){
+        return LV_DRAW_UNIT_IDLE;
+    }
+
+    t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+    t->draw_unit = draw_unit;
+    u->task_act = t;
+
+    if(!s_dma_job_prepare(t, job)){
+        job->failed = true;
+    }else if(!job->src){
+        n = (job->chunk_bytes ? job->chunk_bytes : job->row_bytes) / sizeof(uint16_t);
+        for(uint32_t i = 0; i < n; i++){
+            s_dma_fill_src[i] = job->color;
+        }
+    }else if(esp_ptr_external_ram(job->src)){
+        // Source Written By The Cpu (Theme Preload) May Still Sit In The Cache
+        esp_cache_msync((void*)job->src, (job->src_stride * (job->rows - 1)) + job->row_bytes, ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_UNALIGNED);
+    }
+
+    s_dma_service(u);
+
+    return 1;
+}
+
+static int32_t s_dma_delete_cb(lv_draw_unit_t* draw_unit)
+{
+    // Lvgl Deinit. Async Memcpy Stays Installed
+
+    (void)draw_unit;
+
+    return 0;
+}
+
+static bool IRAM_ATTR s_dma_done_cb(async_memcpy_handle_t mcp, async_memcpy_event_t* event, void* cb_args)
+{
+    // Transfer Done
+    // Gdma Isr Context
+
+    driver_lcd_dma_unit_t* u = (driver_lcd_dma_unit_t*)cb_args;
+
+    u->job.done += 1;
+
+    return false;
+}
+#endif
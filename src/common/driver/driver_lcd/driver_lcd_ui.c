@@ -0,0 +1,492 @@
+// DRIVER_LCD UI
+// OCTOBER 19, 2026
+
+// Ui Side Of driver_lcd. Widget Binding, Time / Weather Formatting & Theme
+// Panel Independent (Lvgl Only), So test_ui_render Links This Same File Against A Headless Display
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/param.h>
+
+#include "sdkconfig.h"
+#include "esp_log.h"
+#if CONFIG_SPIRAM
+#include "esp_heap_caps.h"
+#endif
+#include "lvgl.h"
+
+#include "driver_lcd.h"
+#include "util_dataqueue.h"
+#include "define_common_data_types.h"
+#include "define_rtos_tasks.h"
+
+#ifdef CONFIG_INCLUDE_UI
+#include "ui.h"
+#endif
+
+// Widget Binding. Lvgl Task Only
+typedef struct{
+    lv_obj_t** obj;
+    bool valid;
+    const void* src;
+    char text[DRIVER_LCD_BIND_TEXT_LEN_MAX];
+}driver_lcd_bind_entry_t;
+
+#ifdef CONFIG_INCLUDE_UI
+// Theme. Lvgl Task Only
+typedef struct{
+    uint16_t id_min;
+    uint16_t id_max;
+    const lv_image_dsc_t* bg_day;
+    const lv_image_dsc_t* bg_night;
+}driver_lcd_theme_t;
+
+typedef struct{
+    const lv_image_dsc_t* src;
+    lv_image_dsc_t dsc;
+    uint8_t* buffer;
+    uint32_t loaded;
+}driver_lcd_theme_slot_t;
+#endif
+
+// Extern Variables
+
+// Local Variables
+// Last Rendered Time & Weather (Displayed Resolution)
+// Text Is Formatted Here, In The Lvgl Task, Only When One Of These Changes
+static uint32_t s_ui_minute;
+static uint32_t s_ui_day;
+static int16_t s_ui_temp;
+static int16_t s_ui_humidity;
+static const char* s_wday[7] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
+static const char* s_month[12] = {"January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December"};
+static driver_lcd_bind_entry_t s_bind[DRIVER_LCD_BIND_MAX];
+static driver_lcd_bind_stats_t s_bind_stats;
+static util_dataqueue_timedata_t s_ui_timedata;
+static util_dataqueue_weatherdata_t s_ui_weatherdata;
+static bool s_ui_timedata_valid;
+static bool s_ui_weatherdata_valid;
+
+// Second Indicator
+static bool s_second_panel_visible;
+
+#ifdef CONFIG_INCLUDE_UI
+// Openweather Condition Codes (https://openweathermap.org/weather-conditions). First Match Wins
+// Only Clear Sky Art Exists In The SquareLine Project So Far. Add Rows As Assets Are Added
+static const driver_lcd_theme_t s_themes[] = {
+    { 0,    UINT16_MAX, &ui_img_images_img_clear_day_png,   &ui_img_images_img_clear_night_png  },
+};
+static driver_lcd_theme_slot_t s_theme_slot[2];
+static int8_t s_theme_slot_shown;
+static const lv_image_dsc_t* s_theme_shown;
+static const lv_image_dsc_t* s_theme_wanted;
+#endif
+
+// Local Functions
+static void s_ui_state_reset(void);
+static void s_bind_label_set(driver_lcd_bind_t b, const char* text);
+static void s_bind_image_set(driver_lcd_bind_t b, const void* src);
+#ifdef CONFIG_INCLUDE_UI
+static void s_theme_reset(void);
+static const lv_image_dsc_t* s_theme_select(uint32_t ts);
+static void s_theme_update(void);
+static void s_theme_preload(const lv_image_dsc_t* src);
+static uint8_t* s_theme_slot_alloc(uint32_t size);
+#endif
+static void s_ui_time_update(const util_dataqueue_timedata_t* td);
+static void s_ui_weather_update(const util_dataqueue_weatherdata_t* wd);
+
+// External Functions
+void DRIVER_LCD_UI_Init(void)
+{
+    // Bind SquareLine Widgets To Commands. Created Later By ui_init (DRIVER_LCD_COMMAND_LOAD_UI)
+
+    memset(s_bind, 0, sizeof(s_bind));
+    memset(&s_bind_stats, 0, sizeof(s_bind_stats));
+    #ifdef CONFIG_INCLUDE_UI
+    s_bind[DRIVER_LCD_BIND_IP].obj = &ui_ipaddress;
+    s_bind[DRIVER_LCD_BIND_CONNECTION].obj = &ui_imageconnection;
+    s_bind[DRIVER_LCD_BIND_TIME].obj = &ui_time;
+    s_bind[DRIVER_LCD_BIND_AMPM].obj = &ui_ampm;
+    s_bind[DRIVER_LCD_BIND_DATE].obj = &ui_date;
+    s_bind[DRIVER_LCD_BIND_TEMPERATURE].obj = &uic_labelhtemperature;
+    s_bind[DRIVER_LCD_BIND_HUMIDITY].obj = &ui_labelhumidity;
+    s_bind[DRIVER_LCD_BIND_LOCATION].obj = &ui_label1;
+    #endif
+    s_ui_state_reset();
+}
+
+bool DRIVER_LCD_UI_Command(const util_dataqueue_item_t* dq_i)
+{
+    // Apply A Ui Command To The Widgets
+    // Returns False For Commands That Are Not Ui Commands. Panel Side Follow Up Stays With The Caller
+
+    if(dq_i->data_type != DATA_TYPE_COMMAND){
+        return false;
+    }
+
+    switch(dq_i->data)
+    {
+        case DRIVER_LCD_COMMAND_LOAD_UI:
+            #ifdef CONFIG_INCLUDE_UI
+            ui_init();
+            s_theme_reset();
+            #endif
+            // Fresh Widgets Show Placeholder Text
+            s_ui_state_reset();
+            break;
+
+        case DRIVER_LCD_COMMAND_SET_IP:
+            s_bind_label_set(DRIVER_LCD_BIND_IP, dq_i->data_buff.value.ip);
+            #ifdef CONFIG_INCLUDE_UI
+            if(dq_i->data_buff.value.ip[0] == '\0'){
+                s_bind_image_set(DRIVER_LCD_BIND_CONNECTION, &ui_img_images_button_red_png);
+            }else{
+                s_bind_image_set(DRIVER_LCD_BIND_CONNECTION, &ui_img_images_button_green_png);
+            }
+            #endif
+            break;
+
+        case DRIVER_LCD_COMMAND_SET_TIME:
+            s_ui_time_update(&dq_i->data_buff.value.timedata);
+            #ifdef CONFIG_INCLUDE_UI
+            s_theme_update();
+            #endif
+            break;
+
+        case DRIVER_LCD_COMMAND_SET_WEATHER:
+            s_ui_weather_update(&dq_i->data_buff.value.weatherdata);
+            #ifdef CONFIG_INCLUDE_UI
+            s_theme_update();
+            #endif
+            break;
+
+        case DRIVER_LCD_COMMAND_SET_LOCATION:
+            s_bind_label_set(DRIVER_LCD_BIND_LOCATION, dq_i->data_buff.value.location);
+            break;
+
+        default:
+            return false;
+    }
+
+    return true;
+}
+
+void DRIVER_LCD_UI_SecondToggle(void)
+{
+    // Blink The Second Indicator
+
+    #ifdef CONFIG_INCLUDE_UI
+    if(s_second_panel_visible){
+        lv_obj_add_flag(ui_panel3, LV_OBJ_FLAG_HIDDEN);
+    }else{
+        lv_obj_clear_flag(ui_panel3, LV_OBJ_FLAG_HIDDEN);
+    }
+    #endif
+    s_second_panel_visible = !s_second_panel_visible;
+}
+
+void DRIVER_LCD_UI_Service(void)
+{
+    // One Theme Preload Chunk Per Call, Then Swap When The Wanted Asset Is Complete
+
+    #ifdef CONFIG_INCLUDE_UI
+    uint8_t i = (s_theme_slot_shown == 0) ? 1 : 0;
+    driver_lcd_theme_slot_t* slot = &s_theme_slot[i];
+    uint32_t len;
+
+    if(!slot->src){
+        return;
+    }
+
+    if(slot->loaded < slot->src->data_size){
+        len = MIN(DRIVER_LCD_THEME_CHUNK_BYTES, slot->src->data_size - slot->loaded);
+        memcpy(slot->buffer + slot->loaded, slot->src->data + slot->loaded, len);
+        slot->loaded += len;
+        return;
+    }
+
+    if(slot->src != s_theme_wanted || slot->src == s_theme_shown){
+        return;
+    }
+
+    // Single Source Swap. Pixels Are Already In Psram
+    lv_obj_set_style_bg_image_src(ui_containerbg, &slot->dsc, LV_PART_MAIN | LV_STATE_DEFAULT);
+    s_theme_shown = slot->src;
+    s_theme_slot_shown = i;
+
+    ESP_LOGI(DEBUG_TAG_DRIVER_LCD, "Theme Switch. Slot %u", i);
+    #endif
+}
+
+void DRIVER_LCD_GetBindStats(driver_lcd_bind_stats_t* stats)
+{
+    // Get Widget Binding Counters
+
+    *stats = s_bind_stats;
+}
+
+void DRIVER_LCD_PrintBindStats(void)
+{
+    // Print Widget Binding Counters
+
+    uint32_t total = s_bind_stats.updates + s_bind_stats.suppressed;
+
+    ESP_LOGI(DEBUG_TAG_DRIVER_LCD, "Bind Updates %" PRIu32 ", Suppressed %" PRIu32 " (%" PRIu32 " %%)",
+        s_bind_stats.updates,
+        s_bind_stats.suppressed,
+        total ? (s_bind_stats.suppressed * 100 / total) : 0
+    );
+}
+
+static void s_ui_state_reset(void)
+{
+    // Forget Last Rendered Values. Next Update Renders Every Widget
+
+    s_ui_minute = UINT32_MAX;
+    s_ui_day = UINT32_MAX;
+    s_ui_temp = INT16_MIN;
+    s_ui_humidity = -1;
+    s_second_panel_visible = true;
+
+    for(uint8_t i = 0; i < DRIVER_LCD_BIND_MAX; i++){
+        s_bind[i].valid = false;
+    }
+}
+
+static void s_bind_label_set(driver_lcd_bind_t b, const char* text)
+{
+    // Set Bound Label Text
+    // Skipped When Identical To The Last Rendered Text (No Relayout / Invalidation)
+
+    driver_lcd_bind_entry_t* e = &s_bind[b];
+
+    if(e->valid && strcmp(e->text, text) == 0){
+        s_bind_stats.suppressed += 1;
+        return;
+    }
+
+    snprintf(e->text, sizeof(e->text), "%s", text);
+    e->valid = true;
+    s_bind_stats.updates += 1;
+
+    if(e->obj && *e->obj){
+        lv_label_set_text(*e->obj, text);
+    }
+}
+
+static void s_bind_image_set(driver_lcd_bind_t b, const void* src)
+{
+    // Set Bound Image Source
+    // Skipped When Identical To The Last Rendered Source
+
+    driver_lcd_bind_entry_t* e = &s_bind[b];
+
+    if(e->valid && e->src == src){
+        s_bind_stats.suppressed += 1;
+        return;
+    }
+
+    e->src = src;
+    e->valid = true;
+    s_bind_stats.updates += 1;
+
+    if(e->obj && *e->obj){
+        lv_image_set_src(*e->obj, src);
+    }
+}
+
+static void s_ui_time_update(const util_dataqueue_timedata_t* td)
+{
+    // Format & Render Time Labels
+    // Lvgl Task Only. Date Is Rebuilt Once A Day
+
+    time_t local = (time_t)td->timestamp + td->gmt_offset;
+    struct tm timeinfo;
+    char buffer[48];
+    uint8_t hour;
+
+    s_ui_timedata = *td;
+    s_ui_timedata_valid = true;
+
+    if((uint32_t)(local / 60) == s_ui_minute){
+        return;
+    }
+    s_ui_minute = (uint32_t)(local / 60);
+    gmtime_r(&local, &timeinfo);
+
+    // 12 Hour Clock. 00:xx Is 12:xx AM, 12:xx Is 12:xx PM
+    hour = timeinfo.tm_hour % 12;
+    if(hour == 0){
+        hour = 12;
+    }
+    sprintf(buffer, "%u:%02u", hour, timeinfo.tm_min);
+    s_bind_label_set(DRIVER_LCD_BIND_TIME, buffer);
+    s_bind_label_set(DRIVER_LCD_BIND_AMPM, (timeinfo.tm_hour >= 12) ? "PM" : "AM");
+
+    if(timeinfo.tm_min == 0){
+        DRIVER_LCD_PrintBindStats();
+    }
+
+    if((uint32_t)(local / 86400) == s_ui_day){
+        return;
+    }
+    s_ui_day = (uint32_t)(local / 86400);
+    sprintf(buffer,
+                "%s %u %s, %u",
+                s_wday[timeinfo.tm_wday],
+                timeinfo.tm_mday,
+                s_month[timeinfo.tm_mon],
+                timeinfo.tm_year + 1900
+    );
+    s_bind_label_set(DRIVER_LCD_BIND_DATE, buffer);
+}
+
+static void s_ui_weather_update(const util_dataqueue_weatherdata_t* wd)
+{
+    // Format & Render Weather Labels
+    // Lvgl Task Only. Displayed In Whole Degrees
+
+    char buffer[8];
+    int16_t temp = (wd->temp_centi + ((wd->temp_centi >= 0) ? 50 : -50)) / 100;
+
+    s_ui_weatherdata = *wd;
+    s_ui_weatherdata_valid = true;
+
+    if(temp != s_ui_temp){
+        s_ui_temp = temp;
+        sprintf(buffer, "%d C", temp);
+        s_bind_label_set(DRIVER_LCD_BIND_TEMPERATURE, buffer);
+    }
+
+    if(wd->humidity != s_ui_humidity){
+        s_ui_humidity = wd->humidity;
+        sprintf(buffer, "%u %%", wd->humidity);
+        s_bind_label_set(DRIVER_LCD_BIND_HUMIDITY, buffer);
+    }
+}
+
+#ifdef CONFIG_INCLUDE_UI
+static void s_theme_reset(void)
+{
+    // ui_init Created The Background With The SquareLine Default (Flash) Asset
+    // Psram Copies Are Kept. A Slot Still Holding The Wanted Asset Swaps In Instantly
+
+    s_theme_slot_shown = -1;
+    s_theme_shown = &ui_img_images_img_clear_day_png;
+    s_theme_wanted = s_theme_shown;
+}
+
+static const lv_image_dsc_t* s_theme_select(uint32_t ts)
+{
+    // Pick Background For Utc Time ts From Condition & Day / Night
+
+    const driver_lcd_theme_t* t = &s_themes[0];
+    uint32_t tod = ts % 86400;
+    uint32_t sunrise;
+    uint32_t sunset;
+    uint8_t hour;
+    bool day;
+
+    if(s_ui_weatherdata_valid && s_ui_weatherdata.sunrise && s_ui_weatherdata.sunset){
+        // Time Of Day (Utc) So Today's Sunrise / Sunset Stay Usable Past Midnight
+        sunrise = s_ui_weatherdata.sunrise % 86400;
+        sunset = s_ui_weatherdata.sunset % 86400;
+        if(sunrise < sunset){
+            day = (tod >= sunrise) && (tod < sunset);
+        }else{
+            day = (tod >= sunrise) || (tod < sunset);
+        }
+
+        for(uint8_t i = 0; i < sizeof(s_themes) / sizeof(s_themes[0]); i++){
+            if(s_ui_weatherdata.condition_id >= s_themes[i].id_min && s_ui_weatherdata.condition_id <= s_themes[i].id_max){
+                t = &s_themes[i];
+                break;
+            }
+        }
+    }else{
+        hour = ((ts + s_ui_timedata.gmt_offset) / 3600) % 24;
+        day = (hour >= DRIVER_LCD_THEME_DAY_START_H) && (hour < DRIVER_LCD_THEME_DAY_END_H);
+    }
+
+    return day ? t->bg_day : t->bg_night;
+}
+
+static void s_theme_update(void)
+{
+    // Re-Evaluate Theme After A Time Or Weather Update
+    // Wanted Asset Is Swapped In Once Loaded. An Upcoming Day / Night Change Is Loaded Early
+
+    const lv_image_dsc_t* next;
+
+    // Background Widget Exists Once The Ui Is Loaded
+    if(!s_ui_timedata_valid || !s_theme_shown){
+        return;
+    }
+
+    s_theme_wanted = s_theme_select(s_ui_timedata.timestamp);
+    if(s_theme_wanted != s_theme_shown){
+        s_theme_preload(s_theme_wanted);
+        return;
+    }
+
+    next = s_theme_select(s_ui_timedata.timestamp + DRIVER_LCD_THEME_PRELOAD_S);
+    if(next != s_theme_shown){
+        s_theme_preload(next);
+    }
+}
+
+static void s_theme_preload(const lv_image_dsc_t* src)
+{
+    // Start Copying Asset Into The Slot Not On Screen
+    // Without Psram The Asset Is Shown Straight From Flash
+
+    driver_lcd_theme_slot_t* slot = &s_theme_slot[(s_theme_slot_shown == 0) ? 1 : 0];
+    uint32_t size = 0;
+
+    if(slot->src == src){
+        return;
+    }
+
+    if(!slot->buffer){
+        // Sized For The Largest Asset So A Slot Never Reallocates
+        for(uint8_t i = 0; i < sizeof(s_themes) / sizeof(s_themes[0]); i++){
+            size = MAX(size, s_themes[i].bg_day->data_size);
+            size = MAX(size, s_themes[i].bg_night->data_size);
+        }
+        slot->buffer = s_theme_slot_alloc(size);
+    }
+
+    if(!slot->buffer){
+        #if CONFIG_SPIRAM || defined(DRIVER_LCD_THEME_SLOT_HEAP)
+        ESP_LOGW(DEBUG_TAG_DRIVER_LCD, "Theme Slot Alloc Fail. Direct Switch");
+        #endif
+        if(src == s_theme_wanted){
+            lv_obj_set_style_bg_image_src(ui_containerbg, src, LV_PART_MAIN | LV_STATE_DEFAULT);
+            s_theme_shown = src;
+        }
+        return;
+    }
+
+    slot->src = src;
+    slot->dsc = *src;
+    slot->dsc.data = slot->buffer;
+    slot->loaded = 0;
+}
+
+static uint8_t* s_theme_slot_alloc(uint32_t size)
+{
+    // Theme Slot Buffer. NULL Means No Slots (Direct Switch)
+
+    #if CONFIG_SPIRAM
+    // Cache Line Aligned So The Background Blit Can Go To The Dma Draw Unit
+    return (uint8_t*)heap_caps_aligned_alloc(DRIVER_LCD_DMA_ALIGN, size, MALLOC_CAP_SPIRAM);
+    #elif defined(DRIVER_LCD_THEME_SLOT_HEAP)
+    return (uint8_t*)malloc(size);
+    #else
+    (void)size;
+    return NULL;
+    #endif
+}
+#endif
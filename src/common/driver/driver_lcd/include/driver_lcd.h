@@ -16,9 +16,61 @@
 
 #define DRIVER_LCD_DISPLAY_HRES             (800)
 #define DRIVER_LCD_DISPLAY_VRES             (480)
+// Lvgl Display Rotation (Lvgl Headers Needed Where Used)
+// Matrix Rotation Is Off & The Flush Cb Does Not Rotate, So Pixels Land In The Framebuffer As Rendered
+// Rotation Only Affects Input Coordinates. test_ui_render Sets The Same Value
+#define DRIVER_LCD_DISPLAY_ROTATION         (LV_DISPLAY_ROTATION_180)
 
 #define DRIVER_LCD_DATAQUEUE_MAX            (4)
 
+// Widget Bindings
+// Last Rendered Value Per Widget. Identical Updates Are Dropped Before They Reach Lvgl
+#define DRIVER_LCD_BIND_TEXT_LEN_MAX        (48)
+
+// Theme
+// Background Follows Weather Condition & Day / Night
+// Next Background Is Copied To Psram In Chunks Ahead Of The Switch, Which Is Then A Single Source Swap
+// Without Psram The Switch Is Direct From Flash. DRIVER_LCD_THEME_SLOT_HEAP (Build Flag) Takes The Slots
+// From The Default Heap Instead, So test_ui_render Runs The Same Preload, Chunk & Swap Path
+#define DRIVER_LCD_THEME_PRELOAD_S          (300)           // Start Loading This Long Before Sunrise / Sunset
+#define DRIVER_LCD_THEME_CHUNK_BYTES        (32 * 1024)     // Copied Per Lvgl Task Iteration
+#define DRIVER_LCD_THEME_DAY_START_H        (6)             // Local Day / Night Until Weather Brings Sunrise / Sunset
+#define DRIVER_LCD_THEME_DAY_END_H          (18)
+
+// Frame Metrics
+// Ring Of Recent Rendered Frames (Lvgl Refresh Cycles That Flushed At Least One Area)
+// Bounce Buffer Underruns Have No Esp_lcd Event. A Vsync Arriving Late Means The Panel Isr
+// (Which Also Refills The Bounce Buffers) Was Starved, So Late Vsyncs Are Counted Instead
+#define DRIVER_LCD_FRAME_RING_LEN           (64)
+#define DRIVER_LCD_FRAME_LOG_PERIOD_S       (60)
+#define DRIVER_LCD_FRAME_VSYNC_LATE_US      (35000)         // Nominal 28.3 ms (18 MHz Pclk, 928 x 548 Clocks) + 25 %
+#define DRIVER_LCD_TRACE_PENDING_MAX        (4)             // Traced Commands Awaiting Their Flush (util_trace)
+
+// Lvgl Allocator (CONFIG_LV_USE_CUSTOM_MALLOC)
+// Small Hot Allocations (Objects, Styles, Draw Tasks, Label Text) Go To Internal Ram
+// Large Ones (Layers, Decoded Images, Draw Buffers) Go To Psram
+// Internal Tier Is Capped So Lvgl Never Takes More Fast Ram Than The Former Builtin Pool
+#define DRIVER_LCD_MEM_SMALL_MAX            (1024)          // Largest Allocation Served From Internal Ram
+#define DRIVER_LCD_MEM_INTERNAL_BUDGET      (64 * 1024)
+
+// Splash
+// Pre Rasterized Boot Frame (driver_lcd_splash.c, Generated By scripts/splash_gen.py At Build Time) Painted Into The Panel
+// Framebuffer Right After Panel Init, Before Lvgl Exists. Partial Refresh Drops Lvgl Flushes Until
+// The Ui Is Loaded, So The Default Empty Screen Never Replaces It & The First Flushed Frame Is The Ui
+#define DRIVER_LCD_SPLASH_HOLD_MAX_MS       (5000)          // Hand Over To Lvgl Anyway If No Ui Is Loaded By Then
+
+// Dma Draw Unit
+// Lvgl Draw Unit Next To The Software Renderer. Opaque, Untransformed RGB565 Image Blits & Solid Fills
+// Of Large Areas Are Copied By Gdma (esp_async_memcpy) While The Cpu Renders Independent Tasks
+// Rows Must Start & End On Cache Lines In Destination & Source (Full Width Areas, 32 Px Aligned Columns)
+// So Syncing The Cache Never Touches Pixels Of Neighbouring Tasks. Anything Else Stays With The Cpu
+#define DRIVER_LCD_DMA_ALIGN                (64)            // Psram Cache Line, Worst Case
+#define DRIVER_LCD_DMA_MIN_BYTES            (16 * 1024)     // Smaller Tasks Cost More In Setup Than The Cpu Copy
+#define DRIVER_LCD_DMA_ROW_MIN_BYTES        (512)           // One Transfer Per Row Unless The Area Is Contiguous
+#define DRIVER_LCD_DMA_CHUNK_BYTES          (32 * 1024)     // Largest Single Transfer (Contiguous Image)
+#define DRIVER_LCD_DMA_FILL_SRC_BYTES       (2048)          // Internal Run Of Fill Color, At Least One Display Row
+#define DRIVER_LCD_DMA_BACKLOG              (8)             // Transfers Queued In The Driver
+
 typedef enum {
     DRIVER_LCD_COMMAND_DEMO = 0,
     DRIVER_LCD_COMMAND_LOAD_UI,
@@ -28,8 +80,94 @@ typedef enum {
     DRIVER_LCD_COMMAND_SET_LOCATION,
 }driver_lcd_command_type_t;
 
+typedef enum{
+    DRIVER_LCD_BIND_IP = 0,
+    DRIVER_LCD_BIND_CONNECTION,
+    DRIVER_LCD_BIND_TIME,
+    DRIVER_LCD_BIND_AMPM,
+    DRIVER_LCD_BIND_DATE,
+    DRIVER_LCD_BIND_TEMPERATURE,
+    DRIVER_LCD_BIND_HUMIDITY,
+    DRIVER_LCD_BIND_LOCATION,
+    DRIVER_LCD_BIND_MAX
+}driver_lcd_bind_t;
+
+typedef enum{
+    DRIVER_LCD_MEM_TIER_INTERNAL = 0,
+    DRIVER_LCD_MEM_TIER_PSRAM,
+    DRIVER_LCD_MEM_TIER_MAX
+}driver_lcd_mem_tier_t;
+
+typedef struct{
+    uint32_t updates;
+    uint32_t suppressed;
+}driver_lcd_bind_stats_t;
+
+typedef struct{
+    uint32_t timestamp_ms;      // Frame Start, Since Boot
+    uint32_t render_us;         // Layout & Draw (Refresh Cycle Minus Flush)
+    uint32_t flush_us;          // Flush Callbacks (Full Refresh: Including Vsync Wait) & Lvgl Flush Wait
+    uint32_t pixels;
+    uint32_t mem_used;          // Lvgl Heap At Frame End
+    uint16_t areas;
+    uint16_t vsync_late;        // Late Vsyncs Since The Previous Frame
+}driver_lcd_frame_t;
+
+typedef struct{
+    uint32_t frames;            // Since Boot
+    uint32_t vsync_late;        // Since Boot
+    uint16_t window;            // Frames Below Are Over The Last window Frames
+    uint32_t render_us_avg;
+    uint32_t render_us_max;
+    uint32_t flush_us_avg;
+    uint32_t flush_us_max;
+    uint32_t pixels_avg;
+    uint16_t areas_max;
+    uint32_t mem_used_max;
+}driver_lcd_frame_stats_t;
+
+typedef struct{
+    uint32_t used;              // Bytes Including Heap Block Overhead
+    uint32_t used_max;
+    uint32_t blocks;
+    uint32_t allocs;            // Since Boot
+    uint32_t fails;
+}driver_lcd_mem_tier_stats_t;
+
+typedef struct{
+    driver_lcd_mem_tier_stats_t tier[DRIVER_LCD_MEM_TIER_MAX];
+    uint32_t fallbacks;         // Served From The Other Tier (Budget Reached / Tier Full)
+}driver_lcd_mem_stats_t;
+
+typedef struct{
+    uint32_t fills;
+    uint32_t images;
+    uint32_t transfers;
+    uint32_t kbytes;
+    uint32_t fallbacks;         // Transfer Refused, Task Redrawn By The Cpu
+}driver_lcd_dma_stats_t;
+
 bool DRIVER_LCD_Init(void);
 
 bool DRIVER_LCD_AddCommand(util_dataqueue_item_t* dq_i);
 
+// Ui Side (driver_lcd_ui.c). Lvgl Task Only, No Panel Dependency
+// Also Linked Into test_ui_render, So The Golden Images Exercise This Code
+void DRIVER_LCD_UI_Init(void);
+bool DRIVER_LCD_UI_Command(const util_dataqueue_item_t* dq_i);
+void DRIVER_LCD_UI_SecondToggle(void);
+void DRIVER_LCD_UI_Service(void);
+void DRIVER_LCD_GetBindStats(driver_lcd_bind_stats_t* stats);
+void DRIVER_LCD_PrintBindStats(void);
+
+uint8_t DRIVER_LCD_GetFrames(driver_lcd_frame_t* frames, uint8_t max);
+void DRIVER_LCD_GetFrameStats(driver_lcd_frame_stats_t* stats);
+void DRIVER_LCD_PrintFrameStats(void);
+
+bool DRIVER_LCD_GetMemStats(driver_lcd_mem_stats_t* stats);
+void DRIVER_LCD_PrintMemStats(void);
+
+bool DRIVER_LCD_GetDmaStats(driver_lcd_dma_stats_t* stats);
+void DRIVER_LCD_PrintDmaStats(void);
+
 #endif
\ No newline at end of file
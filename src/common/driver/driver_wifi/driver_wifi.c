@@ -1,38 +1,71 @@
 // DRIVER_WIFI
 // SEPTEMBER 6, 2025
 
+#include <sys/param.h>
+
 #include "esp_wifi.h"
 #include "esp_event.h"
 #include "esp_smartconfig.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "nvs_flash.h"
+#include "nvs.h"
+#ifdef CONFIG_ESP_WIFI_11KV_SUPPORT
+#include "esp_wnm.h"
+#endif
 #include "lwip/err.h"
 #include "lwip/sys.h"
 
 #include "driver_wifi.h"
 #include "driver_chipinfo.h"
 #include "util_dataqueue.h"
+#include "util_executor.h"
+#include "util_dlog.h"
 #include "define_common_data_types.h"
 #include "define_rtos_tasks.h"
 
+// Last Ap That Gave An Ip (Nvs)
+typedef struct{
+    char ssid[DRIVER_WIFI_LEN_SSID_MAX];
+    uint8_t bssid[6];
+    uint8_t channel;
+}driver_wifi_fast_t;
+
 // Extern Variables
-TaskHandle_t handle_task_driver_wifi;
 
 // Local Variables
 static rtos_component_type_t s_component_type;
 static util_dataqueue_t s_dataqueue;
+static util_executor_client_t s_executor_client;
 static uint8_t s_notification_targets_count;
 static util_dataqueue_t* s_notification_targets[DRIVER_WIFI_NOTIFICATION_TARGET_MAX];
 static char s_ssid[DRIVER_WIFI_LEN_SSID_MAX];
 static char s_password[DRIVER_WIFI_LEN_PWD_MAX];
-static uint16_t s_scan_ap_count;
 static wifi_ap_record_t* s_scan_ap_records;
+static driver_wifi_fast_t s_fast;
+static bool s_fast_valid;
+static volatile bool s_fast_attempt;
+static volatile bool s_fast_skip;
+static volatile int64_t s_connect_start_us;
+static volatile bool s_reconnecting;
+static driver_wifi_scan_entry_t s_roam_target;
+static bool s_roam_pending;
+static driver_wifi_connect_stats_t s_connect_stats;
+static driver_wifi_scan_entry_t s_scan_table[DRIVER_WIFI_SCAN_TABLE_MAX];
+static uint8_t s_scan_table_count;
+static uint16_t s_scan_channel_mask;
+static portMUX_TYPE s_scan_lock = portMUX_INITIALIZER_UNLOCKED;
 
 // Local Functions
 static void s_wifi_connect(void);
 static void s_wifi_disconnect(void);
+static void s_wifi_roam(void);
+static void s_fast_load(void);
+static void s_fast_save(void);
+static bool s_scan_start(uint16_t channel_mask);
+static void s_scan_collect(void);
 static bool s_notify(util_dataqueue_item_t* dq_i, TickType_t wait);
-static void s_task_function(void *pvParameters);
+static void s_on_message(util_dataqueue_item_t* dq_i);
 static void s_event_handler_wifi(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data);
 static void s_event_handler_smartconfig(void *arg, esp_event_base_t event_base, int32_t event_id, void *event_data);
 
@@ -49,7 +82,7 @@ bool DRIVER_WIFI_Init(void)
     UTIL_DATAQUEUE_Create(&s_dataqueue, DRIVER_WIFI_DATAQUEUE_MAX);
     s_notification_targets_count = 0;
 
-    s_component_type = COMPONENT_TYPE_TASK;
+    s_component_type = COMPONENT_TYPE_EXECUTOR_CLIENT;
 
     // Allocate Space For Scan AP Records
     s_scan_ap_records = (wifi_ap_record_t*)malloc(DRIVER_WIFI_SCAN_RESULTS_COUNT_MAX * sizeof(wifi_ap_record_t));
@@ -58,6 +91,9 @@ bool DRIVER_WIFI_Init(void)
     // Initialize NVS
     ESP_ERROR_CHECK(nvs_flash_init());
     esp_wifi_set_storage(WIFI_STORAGE_FLASH);
+    s_fast_load();
+    memset(&s_connect_stats, 0, sizeof(s_connect_stats));
+    s_scan_table_count = 0;
 
     // Initialize WiFi And TcpIP
     ESP_ERROR_CHECK(esp_netif_init());
@@ -98,15 +134,12 @@ bool DRIVER_WIFI_Init(void)
         NULL
     ));
 
-    // Create Driver Wifi Task
-    xTaskCreate(
-        s_task_function,
-        "t-d-wifi",
-        TASK_STACK_DEPTH_DRIVER_WIFI,
-        NULL,
-        TASK_PRIORITY_DRIVER_WIFI,
-        &handle_task_driver_wifi
-    );
+    // Register With Executor
+    s_executor_client.name = "d-wifi";
+    s_executor_client.core = EXECUTOR_CORE_DRIVER_WIFI;
+    s_executor_client.dq = &s_dataqueue;
+    s_executor_client.on_message = s_on_message;
+    UTIL_EXECUTOR_Register(&s_executor_client);
 
     ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "Type %u. Init. Hostname %s", s_component_type, hostname);
 
@@ -144,6 +177,21 @@ void DRIVER_WIFI_SetWifiCredentials(uint8_t* ssid, uint8_t* pwd)
     memcpy(s_password, pwd, DRIVER_WIFI_LEN_PWD_MAX);
 }
 
+void DRIVER_WIFI_GetWifiCredentials(char* ssid, char* pwd)
+{
+    // Return Current Wifi Credentials
+
+    memcpy(ssid, s_ssid, DRIVER_WIFI_LEN_SSID_MAX);
+    memcpy(pwd, s_password, DRIVER_WIFI_LEN_PWD_MAX);
+}
+
+bool DRIVER_WIFI_GetRssi(int* rssi)
+{
+    // Rssi Of The Connected Ap
+
+    return (esp_wifi_sta_get_rssi(rssi) == ESP_OK);
+}
+
 bool DRIVER_WIFI_AddCommand(util_dataqueue_item_t* dq_i)
 {
     // Add Command
@@ -171,23 +219,134 @@ bool DRIVER_WIFI_AddNotificationTarget(util_dataqueue_t* dq)
     return true;
 }
 
+void DRIVER_WIFI_GetConnectStats(driver_wifi_connect_stats_t* stats)
+{
+    // Return Connect Statistics
+
+    *stats = s_connect_stats;
+}
+
+uint8_t DRIVER_WIFI_GetScanTable(driver_wifi_scan_entry_t* entries, uint8_t max)
+{
+    // Copy Scan Table, Strongest First
+    // Returns Entries Copied
+
+    uint8_t count;
+
+    taskENTER_CRITICAL(&s_scan_lock);
+    count = MIN(max, s_scan_table_count);
+    memcpy(entries, s_scan_table, count * sizeof(driver_wifi_scan_entry_t));
+    taskEXIT_CRITICAL(&s_scan_lock);
+
+    return count;
+}
+
+bool DRIVER_WIFI_GetScanBest(const char* ssid, driver_wifi_scan_entry_t* entry)
+{
+    // Strongest Fresh Entry For ssid
+
+    uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    bool found = false;
+
+    taskENTER_CRITICAL(&s_scan_lock);
+    for(uint8_t i = 0; i < s_scan_table_count; i++){
+        if((now_ms - s_scan_table[i].seen_ms) <= (DRIVER_WIFI_SCAN_AGE_MAX_S * 1000) &&
+            strncmp(s_scan_table[i].ssid, ssid, DRIVER_WIFI_LEN_SSID_MAX) == 0){
+            *entry = s_scan_table[i];
+            found = true;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL(&s_scan_lock);
+
+    return found;
+}
+
+void DRIVER_WIFI_PrintScanTable(void)
+{
+    // Print Scan Table
+
+    driver_wifi_scan_entry_t* entries;
+    uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    uint8_t count;
+
+    entries = (driver_wifi_scan_entry_t*)malloc(DRIVER_WIFI_SCAN_TABLE_MAX * sizeof(driver_wifi_scan_entry_t));
+    if(!entries){
+        return;
+    }
+    count = DRIVER_WIFI_GetScanTable(entries, DRIVER_WIFI_SCAN_TABLE_MAX);
+
+    ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "%u AP In Scan Table", count);
+    for(uint8_t i = 0; i < count; i++){
+        ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "[%02u] %-32s " MACSTR " | RSSI %4d | Ch %2u | Auth %u | Age %3" PRIu32 " s",
+            i + 1,
+            entries[i].ssid,
+            MAC2STR(entries[i].bssid),
+            entries[i].rssi,
+            entries[i].channel,
+            entries[i].authmode,
+            (now_ms - entries[i].seen_ms) / 1000
+        );
+    }
+
+    free(entries);
+}
+
 static void s_wifi_connect(void)
 {
     // Connect Wifi
     // Assumes Target Wifi Credentials Are Present In s_ssid & s_password
+    // Directed At The Roam Target, Else The Cached Ap When It Belongs To s_ssid, Else At The Strongest
+    // Fresh Scan Table Entry. Otherwise Strongest Ap After A Full Scan
 
+    driver_wifi_scan_entry_t best;
     wifi_config_t w_config = {
         .sta = {
             .ssid = "",
-            .password = ""
+            .password = "",
+            .scan_method = WIFI_ALL_CHANNEL_SCAN,
+            .sort_method = WIFI_CONNECT_AP_BY_SIGNAL
         }
     };
     strcpy((char*)w_config.sta.ssid, s_ssid);
     strcpy((char*)w_config.sta.password, s_password);
 
-    ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "Connecting...");
+    if(s_connect_start_us == 0){
+        s_connect_start_us = esp_timer_get_time();
+    }
+
+    s_fast_attempt = false;
+    if(s_roam_pending){
+        memcpy(w_config.sta.bssid, s_roam_target.bssid, sizeof(s_roam_target.bssid));
+        w_config.sta.channel = s_roam_target.channel;
+        s_fast_attempt = true;
+        s_roam_pending = false;
+    }else if(!s_fast_skip && s_fast_valid && (strncmp(s_fast.ssid, s_ssid, DRIVER_WIFI_LEN_SSID_MAX) == 0)){
+        memcpy(w_config.sta.bssid, s_fast.bssid, sizeof(s_fast.bssid));
+        w_config.sta.channel = s_fast.channel;
+        s_fast_attempt = true;
+    }else if(!s_fast_skip && DRIVER_WIFI_GetScanBest(s_ssid, &best)){
+        memcpy(w_config.sta.bssid, best.bssid, sizeof(best.bssid));
+        w_config.sta.channel = best.channel;
+        s_fast_attempt = true;
+    }
+
+    if(s_fast_attempt){
+        w_config.sta.scan_method = WIFI_FAST_SCAN;
+        w_config.sta.bssid_set = true;
+        ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "Connecting (Fast, " MACSTR " Ch %u)...", MAC2STR(w_config.sta.bssid), w_config.sta.channel);
+    }else{
+        ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "Connecting (Full Scan)...");
+    }
+
+    // Advertise 802.11k / v So Capable Aps Answer Bss Transition Queries
+    #ifdef CONFIG_ESP_WIFI_11KV_SUPPORT
+    w_config.sta.rm_enabled = 1;
+    w_config.sta.btm_enabled = 1;
+    #endif
 
     ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &w_config));
+    s_reconnecting = true;
     esp_wifi_disconnect();
     esp_wifi_connect();
 }
@@ -201,6 +360,194 @@ static void s_wifi_disconnect(void)
     esp_wifi_disconnect();
 }
 
+static void s_wifi_roam(void)
+{
+    // Move To A Stronger Ap Of The Same Ssid
+    // Expects A Fresh Scan Table (Channel Restricted Scan Just Before)
+
+    wifi_ap_record_t ap;
+    driver_wifi_scan_entry_t best;
+
+    if(esp_wifi_sta_get_ap_info(&ap) != ESP_OK){
+        return;
+    }
+
+    // Ap Knows Its Neighbours & Their Load Better Than A Scan. Bss Transition Request Is Handled By The Supplicant
+    #ifdef CONFIG_ESP_WIFI_11KV_SUPPORT
+    if(esp_wnm_is_btm_supported_connection() && esp_wnm_send_bss_transition_mgmt_query(REASON_RSSI, NULL, 0) == 0){
+        s_connect_stats.roam_queries += 1;
+        ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "Roam. Bss Transition Query Sent (%d dBm)", ap.rssi);
+        return;
+    }
+    #endif
+
+    if(!DRIVER_WIFI_GetScanBest(s_ssid, &best) ||
+        memcmp(best.bssid, ap.bssid, sizeof(best.bssid)) == 0 ||
+        best.rssi < ap.rssi + DRIVER_WIFI_ROAM_GAIN_DB){
+        ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "Roam. No Better Ap (%d dBm)", ap.rssi);
+        return;
+    }
+
+    ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "Roam " MACSTR " (%d dBm) -> " MACSTR " (%d dBm)",
+        MAC2STR(ap.bssid), ap.rssi,
+        MAC2STR(best.bssid), best.rssi
+    );
+    s_connect_stats.roams += 1;
+    s_roam_target = best;
+    s_roam_pending = true;
+    s_wifi_connect();
+}
+
+static void s_fast_load(void)
+{
+    // Restore Last Ap From Nvs
+
+    nvs_handle_t handle;
+    size_t len = sizeof(s_fast);
+
+    s_fast_valid = false;
+    if(nvs_open(DRIVER_WIFI_FAST_NVS_NAMESPACE, NVS_READONLY, &handle) != ESP_OK){
+        return;
+    }
+
+    // Size Mismatch = Struct Changed Since It Was Saved
+    s_fast_valid = (nvs_get_blob(handle, DRIVER_WIFI_FAST_NVS_KEY, &s_fast, &len) == ESP_OK) && (len == sizeof(s_fast));
+    nvs_close(handle);
+
+    if(s_fast_valid){
+        ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "Fast Reconnect Ap %.32s " MACSTR " Ch %u", s_fast.ssid, MAC2STR(s_fast.bssid), s_fast.channel);
+    }
+}
+
+static void s_fast_save(void)
+{
+    // Persist The Ap Currently Connected To
+    // Flash Is Only Written When The Ap Or Its Channel Changed
+
+    wifi_ap_record_t ap;
+    driver_wifi_fast_t fast;
+    nvs_handle_t handle;
+
+    if(esp_wifi_sta_get_ap_info(&ap) != ESP_OK){
+        return;
+    }
+
+    memset(&fast, 0, sizeof(fast));
+    strncpy(fast.ssid, s_ssid, DRIVER_WIFI_LEN_SSID_MAX);
+    memcpy(fast.bssid, ap.bssid, sizeof(fast.bssid));
+    fast.channel = ap.primary;
+
+    if(s_fast_valid && memcmp(&fast, &s_fast, sizeof(fast)) == 0){
+        return;
+    }
+
+    s_fast = fast;
+    s_fast_valid = true;
+
+    if(nvs_open(DRIVER_WIFI_FAST_NVS_NAMESPACE, NVS_READWRITE, &handle) != ESP_OK){
+        ESP_LOGW(DEBUG_TAG_DRIVER_WIFI, "Fast Reconnect Nvs Open Fail");
+        return;
+    }
+    nvs_set_blob(handle, DRIVER_WIFI_FAST_NVS_KEY, &s_fast, sizeof(s_fast));
+    nvs_commit(handle);
+    nvs_close(handle);
+
+    ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "Fast Reconnect Ap Saved " MACSTR " Ch %u", MAC2STR(s_fast.bssid), s_fast.channel);
+}
+
+static bool s_scan_start(uint16_t channel_mask)
+{
+    // Start An Active Scan. Results Arrive With WIFI_EVENT_SCAN_DONE
+    // channel_mask 0 = All Channels. Returns False If The Scan Did Not Start
+
+    wifi_scan_config_t wifi_scan_config;
+    esp_err_t err;
+
+    memset(&wifi_scan_config, 0, sizeof(wifi_scan_config));
+    wifi_scan_config.show_hidden = false;
+    wifi_scan_config.scan_type = WIFI_SCAN_TYPE_ACTIVE;
+    wifi_scan_config.scan_time.active.min = DRIVER_WIFI_SCAN_CHANNEL_TIME_MIN_MS;
+    wifi_scan_config.scan_time.active.max = DRIVER_WIFI_SCAN_CHANNEL_TIME_MAX_MS;
+    wifi_scan_config.channel_bitmap.ghz_2_channels = channel_mask;
+
+    // Fails While Connecting Or If A Scan Is Already Running
+    err = esp_wifi_scan_start(&wifi_scan_config, false);
+    if(err != ESP_OK){
+        ESP_LOGW(DEBUG_TAG_DRIVER_WIFI, "Scan Start Fail %s", esp_err_to_name(err));
+        return false;
+    }
+    s_scan_channel_mask = channel_mask;
+
+    ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "Scanning Channels 0x%04x", channel_mask);
+
+    return true;
+}
+
+static void s_scan_collect(void)
+{
+    // Merge Results Of The Finished Scan Into The Table
+    // Entries On Scanned Channels Not Found Again Are Dropped, Others Age Out. Table Kept Sorted By Rssi
+
+    wifi_ap_record_t* r;
+    driver_wifi_scan_entry_t e;
+    uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    uint16_t count = DRIVER_WIFI_SCAN_RESULTS_COUNT_MAX;
+    uint8_t n;
+    uint8_t j;
+    int8_t best;
+
+    if(esp_wifi_scan_get_ap_records(&count, s_scan_ap_records) != ESP_OK){
+        count = 0;
+    }
+
+    taskENTER_CRITICAL(&s_scan_lock);
+
+    // Drop Stale & Rescanned Entries
+    n = 0;
+    for(uint8_t i = 0; i < s_scan_table_count; i++){
+        e = s_scan_table[i];
+        if((now_ms - e.seen_ms) > (DRIVER_WIFI_SCAN_AGE_MAX_S * 1000)){
+            continue;
+        }
+        if(s_scan_channel_mask == 0 || (s_scan_channel_mask & (1 << e.channel))){
+            continue;
+        }
+        s_scan_table[n++] = e;
+    }
+    s_scan_table_count = n;
+
+    // Insert Fresh Results In Rssi Order. Weakest Falls Off A Full Table
+    for(uint16_t i = 0; i < count; i++){
+        r = &s_scan_ap_records[i];
+        if(s_scan_table_count == DRIVER_WIFI_SCAN_TABLE_MAX && r->rssi <= s_scan_table[s_scan_table_count - 1].rssi){
+            continue;
+        }
+
+        memset(&e, 0, sizeof(e));
+        memcpy(e.ssid, r->ssid, DRIVER_WIFI_LEN_SSID_MAX);
+        memcpy(e.bssid, r->bssid, sizeof(e.bssid));
+        e.rssi = r->rssi;
+        e.channel = r->primary;
+        e.authmode = (uint8_t)r->authmode;
+        e.seen_ms = now_ms;
+
+        j = MIN(s_scan_table_count, DRIVER_WIFI_SCAN_TABLE_MAX - 1);
+        while(j > 0 && s_scan_table[j - 1].rssi < e.rssi){
+            s_scan_table[j] = s_scan_table[j - 1];
+            j -= 1;
+        }
+        s_scan_table[j] = e;
+        s_scan_table_count = MIN(s_scan_table_count + 1, DRIVER_WIFI_SCAN_TABLE_MAX);
+    }
+    n = s_scan_table_count;
+    best = n ? s_scan_table[0].rssi : 0;
+
+    taskEXIT_CRITICAL(&s_scan_lock);
+
+    // Summary Only. Full Table On Demand Through DRIVER_WIFI_PrintScanTable
+    UTIL_DLOGI(DEBUG_TAG_DRIVER_WIFI, "Scan Done. %u Found, %u In Table, Best %d dBm", count, n, best);
+}
+
 static bool s_notify(util_dataqueue_item_t* dq_i, TickType_t wait)
 {
     // Send Notification
@@ -214,68 +561,68 @@ static bool s_notify(util_dataqueue_item_t* dq_i, TickType_t wait)
     return true;
 }
 
-static void s_task_function(void *pvParameters)
+static void s_on_message(util_dataqueue_item_t* dq_i)
 {
-    // Task Function
+    // Executor Message Handler
 
-    util_dataqueue_item_t dq_i;
-    wifi_scan_config_t wifi_scan_config;
+    util_dataqueue_item_t dq_n;
 
-    ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "Starting task");
+    UTIL_DLOGI(DEBUG_TAG_DRIVER_WIFI, "New In DataQueue. Type %u, Data %u", dq_i->data_type, dq_i->data);
 
-    while(true){
-        // Check Data Queue
-        if(UTIL_DATAQUEUE_MessageCheck(&s_dataqueue))
+    if(dq_i->data_type == DATA_TYPE_COMMAND)
+    {
+        switch(dq_i->data)
         {
-            if(UTIL_DATAQUEUE_MessageGet(&s_dataqueue, &dq_i, 0))
-            {
-                ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "New In DataQueue. Type %u, Data %u", dq_i.data_type, dq_i.data);
-                
-                if(dq_i.data_type == DATA_TYPE_COMMAND)
-                {
-                    switch(dq_i.data)
-                    {
-                        case DRIVER_WIFI_COMMAND_SCAN:
-                            wifi_scan_config.ssid = NULL;
-                            wifi_scan_config.bssid = NULL;
-                            wifi_scan_config.channel = 0;
-                            wifi_scan_config.show_hidden = false;
-                            wifi_scan_config.scan_type = WIFI_SCAN_TYPE_ACTIVE,
-                            wifi_scan_config.scan_time.active.min = 100;
-                            wifi_scan_config.scan_time.active.max = 300;
-
-                            ESP_ERROR_CHECK(esp_wifi_scan_start(&wifi_scan_config, false));
-                            break;
-
-                        case DRIVER_WIFI_COMMAND_SMARTCONFIG:
-                            smartconfig_start_config_t cfg = SMARTCONFIG_START_CONFIG_DEFAULT();
-                            ESP_ERROR_CHECK(esp_smartconfig_start(&cfg));
-                            break;
-
-                        case DRIVER_WIFI_COMMAND_CONNECT:
-                            s_wifi_connect();
-                            break;
-                        
-                        case DRIVER_WIFI_COMMAND_DISCONNECT:
-                            s_wifi_disconnect();
-                            break;
-                        
-                        default:
-                            break;
-                    }
-                }
-                else if(dq_i.data_type == DATA_TYPE_NOTIFICATION)
-                {
-                    // Do Nothing
-                    // No Notification Expected For This Module
+            case DRIVER_WIFI_COMMAND_SCAN:
+            case DRIVER_WIFI_COMMAND_SCAN_CHANNELS:
+                if(s_scan_start((dq_i->data == DRIVER_WIFI_COMMAND_SCAN) ? 0 : dq_i->data_buff.value.channel_mask)){
+                    break;
                 }
-            }
-        }
-        
-        vTaskDelay(pdMS_TO_TICKS(500));
-    };
 
-    vTaskDelete(NULL);
+                // Scan Did Not Start. SCAN_DONE Anyway (Table Unchanged) So Waiting Modules Move On
+                dq_n.data_type = DATA_TYPE_NOTIFICATION;
+                dq_n.data = DRIVER_WIFI_NOTIFICATION_SCAN_DONE;
+                s_notify(&dq_n, 0);
+                break;
+
+            case DRIVER_WIFI_COMMAND_SCAN_COLLECT:
+                s_scan_collect();
+
+                dq_n.data_type = DATA_TYPE_NOTIFICATION;
+                dq_n.data = DRIVER_WIFI_NOTIFICATION_SCAN_DONE;
+                s_notify(&dq_n, 0);
+                break;
+
+            case DRIVER_WIFI_COMMAND_SMARTCONFIG:
+                smartconfig_start_config_t cfg = SMARTCONFIG_START_CONFIG_DEFAULT();
+                ESP_ERROR_CHECK(esp_smartconfig_start(&cfg));
+                break;
+
+            case DRIVER_WIFI_COMMAND_CONNECT:
+                s_wifi_connect();
+                break;
+            
+            case DRIVER_WIFI_COMMAND_DISCONNECT:
+                s_wifi_disconnect();
+                break;
+
+            case DRIVER_WIFI_COMMAND_FAST_SAVE:
+                s_fast_save();
+                break;
+
+            case DRIVER_WIFI_COMMAND_ROAM:
+                s_wifi_roam();
+                break;
+            
+            default:
+                break;
+        }
+    }
+    else if(dq_i->data_type == DATA_TYPE_NOTIFICATION)
+    {
+        // Do Nothing
+        // No Notification Expected For This Module
+    }
 }
 
 static void s_event_handler_wifi(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data)
@@ -283,6 +630,8 @@ static void s_event_handler_wifi(void* arg, esp_event_base_t event_base, int32_t
     // Wifi Event Handler
 
     util_dataqueue_item_t dq_i;
+    wifi_event_sta_disconnected_t* disconnected;
+    uint32_t took_ms;
     dq_i.data_type = DATA_TYPE_NOTIFICATION;
 
     if(event_base == WIFI_EVENT)
@@ -295,13 +644,35 @@ static void s_event_handler_wifi(void* arg, esp_event_base_t event_base, int32_t
             
             case WIFI_EVENT_STA_CONNECTED:
                 ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "WIFI_EVENT_STA_CONNECTED");
+                s_reconnecting = false;
 
                 dq_i.data = DRIVER_WIFI_NOTIFICATION_CONNECTED;
                 s_notify(&dq_i, 0);
                 break;
             
             case WIFI_EVENT_STA_DISCONNECTED:
-                ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "WIFI_EVENT_STA_DISCONNECTED");
+                disconnected = (wifi_event_sta_disconnected_t*)event_data;
+                ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "WIFI_EVENT_STA_DISCONNECTED. Reason %u", disconnected->reason);
+
+                // Own Disconnect Ahead Of A (Re)Connect, Or Supplicant Roaming (802.11v). Not A Link Loss
+                if((s_reconnecting && disconnected->reason == WIFI_REASON_ASSOC_LEAVE) || disconnected->reason == WIFI_REASON_ROAMING){
+                    s_reconnecting = false;
+                    break;
+                }
+
+                // Cached Ap Gone / Moved. Retry Right Away With A Full Scan
+                // Deliberate Disconnects (ASSOC_LEAVE) Are Not Failures
+                if(s_fast_attempt && disconnected->reason != WIFI_REASON_ASSOC_LEAVE){
+                    s_fast_attempt = false;
+                    s_fast_skip = true;
+                    s_connect_stats.fast_misses += 1;
+                    ESP_LOGW(DEBUG_TAG_DRIVER_WIFI, "Fast Connect Failed. Full Scan");
+
+                    dq_i.data_type = DATA_TYPE_COMMAND;
+                    dq_i.data = DRIVER_WIFI_COMMAND_CONNECT;
+                    DRIVER_WIFI_AddCommand(&dq_i);
+                    break;
+                }
 
                 dq_i.data = DRIVER_WIFI_NOTIFICATION_DISCONNECTED;
                 s_notify(&dq_i, 0);
@@ -310,22 +681,10 @@ static void s_event_handler_wifi(void* arg, esp_event_base_t event_base, int32_t
             case WIFI_EVENT_SCAN_DONE:
                 ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "WIFI_EVENT_SCAN_DONE");
 
-                s_scan_ap_count = DRIVER_WIFI_SCAN_RESULTS_COUNT_MAX;
-                ESP_ERROR_CHECK(esp_wifi_scan_get_ap_records(&s_scan_ap_count, s_scan_ap_records));
-                
-                ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "%u AP Found", s_scan_ap_count);
-
-                for (int i = 0; i < s_scan_ap_count; i++) {
-                    ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "[%02d] SSID: %-32s | RSSI: %d | Channel: %d | Auth: %d",
-                        i + 1,
-                        s_scan_ap_records[i].ssid,
-                        s_scan_ap_records[i].rssi,
-                        s_scan_ap_records[i].primary,
-                        s_scan_ap_records[i].authmode);
-                };
-
-                dq_i.data = DRIVER_WIFI_NOTIFICATION_SCAN_DONE;
-                s_notify(&dq_i, 0);
+                // Results Are Read & Merged In The Driver Task. SCAN_DONE Is Notified From There
+                dq_i.data_type = DATA_TYPE_COMMAND;
+                dq_i.data = DRIVER_WIFI_COMMAND_SCAN_COLLECT;
+                DRIVER_WIFI_AddCommand(&dq_i);
                 break;
             
             default:
@@ -345,6 +704,27 @@ static void s_event_handler_wifi(void* arg, esp_event_base_t event_base, int32_t
                 ip_event_got_ip_t* event = (ip_event_got_ip_t*)event_data;
                 ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "IP : " IPSTR, IP2STR(&(event->ip_info.ip)));
 
+                // Time To Ip
+                took_ms = s_connect_start_us ? (uint32_t)((esp_timer_get_time() - s_connect_start_us) / 1000) : 0;
+                s_connect_start_us = 0;
+                s_connect_stats.connects += 1;
+                s_connect_stats.fast_hits += s_fast_attempt ? 1 : 0;
+                s_connect_stats.time_to_ip_ms_last = took_ms;
+                s_connect_stats.time_to_ip_ms_max = MAX(s_connect_stats.time_to_ip_ms_max, took_ms);
+                ESP_LOGI(DEBUG_TAG_DRIVER_WIFI, "Time To Ip %" PRIu32 " ms (%s%s)",
+                    took_ms,
+                    s_fast_attempt ? "Fast" : "Full Scan",
+                    event->ip_changed ? "" : ", Same Ip"
+                );
+                s_fast_attempt = false;
+                s_fast_skip = false;
+
+                // Nvs Write Off The Event Loop
+                dq_i.data_type = DATA_TYPE_COMMAND;
+                dq_i.data = DRIVER_WIFI_COMMAND_FAST_SAVE;
+                DRIVER_WIFI_AddCommand(&dq_i);
+                dq_i.data_type = DATA_TYPE_NOTIFICATION;
+
                 // Send Notification
                 memset(&dq_i, sizeof(util_dataqueue_item_t), 0);
                 sprintf(dq_i.data_buff.value.ip, IPSTR, IP2STR(&(event->ip_info.ip)));
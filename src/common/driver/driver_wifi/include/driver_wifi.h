@@ -15,22 +15,46 @@
 #define DRIVER_WIFI_LEN_SSID_MAX                (32)
 #define DRIVER_WIFI_LEN_PWD_MAX                 (64)
 
-#define DRIVER_WIFI_SCAN_RESULTS_COUNT_MAX      (10)
+// Scan Table
+// Scan Results Are Collected In The Driver Task (Not The Event Loop) & Merged Into A Table Sorted By Rssi
+// Channel Restricted Scans Refresh Only Their Channels. Entries Not Seen For DRIVER_WIFI_SCAN_AGE_MAX_S Drop Out
+// A Connect Without A Cached Ap Goes Straight To The Strongest Fresh Entry For The Ssid
+#define DRIVER_WIFI_SCAN_RESULTS_COUNT_MAX      (16)
+#define DRIVER_WIFI_SCAN_TABLE_MAX              (16)
+#define DRIVER_WIFI_SCAN_AGE_MAX_S              (120)
+#define DRIVER_WIFI_SCAN_CHANNEL_TIME_MIN_MS    (100)
+#define DRIVER_WIFI_SCAN_CHANNEL_TIME_MAX_MS    (300)
+
+// Roaming (DRIVER_WIFI_COMMAND_ROAM, Same Ssid)
+// 802.11v Capable Ap (CONFIG_ESP_WIFI_11KV_SUPPORT) Is Asked For A Bss Transition & Steers Us Itself
+// Otherwise Moves To The Strongest Scan Table Ap If It Beats The Current One By DRIVER_WIFI_ROAM_GAIN_DB
+#define DRIVER_WIFI_ROAM_GAIN_DB                (8)
 
 #define DRIVER_WIFI_DATAQUEUE_MAX               (3)
 #define DRIVER_WIFI_NOTIFICATION_TARGET_MAX     (2)
 
 #define DRIVER_WIFI_HOSTNAME_PREFIX             "ESP32-LVGL"
 
+// Fast Reconnect
+// Bssid & Channel Of The Last Connection That Got An Ip Are Kept In Nvs. Connecting To The Same Ssid
+// Goes Straight To That Ap On That Channel (No Channel Sweep), Falling Back To A Full Scan If It Fails
+// The Dhcp Lease Is Kept By Lwip (CONFIG_LWIP_DHCP_RESTORE_LAST_IP), Which Requests The Last Ip Directly
+#define DRIVER_WIFI_FAST_NVS_NAMESPACE          "driver_wifi"
+#define DRIVER_WIFI_FAST_NVS_KEY                "fast"
+
 typedef enum {
     DRIVER_WIFI_COMMAND_SCAN = 0,
     DRIVER_WIFI_COMMAND_SMARTCONFIG,
     DRIVER_WIFI_COMMAND_CONNECT,
-    DRIVER_WIFI_COMMAND_DISCONNECT
+    DRIVER_WIFI_COMMAND_DISCONNECT,
+    DRIVER_WIFI_COMMAND_FAST_SAVE,                  // Internal. Persist The Ap Just Connected To
+    DRIVER_WIFI_COMMAND_SCAN_CHANNELS,              // data_buff.value.channel_mask
+    DRIVER_WIFI_COMMAND_SCAN_COLLECT,               // Internal. Read Results After WIFI_EVENT_SCAN_DONE
+    DRIVER_WIFI_COMMAND_ROAM
 }driver_wifi_command_type_t;
 
 typedef enum{
-    DRIVER_WIFI_NOTIFICATION_SCAN_DONE = 0,
+    DRIVER_WIFI_NOTIFICATION_SCAN_DONE = UTIL_DATAQUEUE_NOTIFICATION_BASE_DRIVER_WIFI,
     DRIVER_WIFI_NOTIFICATION_SMARTCONFIG_GOT_CREDENTIALS,
     DRIVER_WIFI_NOTIFICATION_CONNECTED,
     DRIVER_WIFI_NOTIFICATION_GOT_IP,
@@ -38,12 +62,39 @@ typedef enum{
     DRIVER_WIFI_NOTIFICATION_DISCONNECTED
 }driver_wifi_notification_type_t;
 
+typedef struct{
+    char ssid[DRIVER_WIFI_LEN_SSID_MAX + 1];
+    uint8_t bssid[6];
+    int8_t rssi;
+    uint8_t channel;
+    uint8_t authmode;                   // wifi_auth_mode_t
+    uint32_t seen_ms;                   // Last Scan That Found It, Since Boot
+}driver_wifi_scan_entry_t;
+
+typedef struct{
+    uint32_t connects;                  // Got Ip, Since Boot
+    uint32_t fast_hits;                 // Got Ip Through The Cached Ap
+    uint32_t fast_misses;               // Cached Ap Failed, Retried With A Full Scan
+    uint32_t time_to_ip_ms_last;        // First Connect Attempt To Got Ip
+    uint32_t time_to_ip_ms_max;
+    uint32_t roams;                     // Directed Moves To A Stronger Ap
+    uint32_t roam_queries;              // 802.11v Bss Transition Queries Sent
+}driver_wifi_connect_stats_t;
+
 bool DRIVER_WIFI_Init(void);
 
 bool DRIVER_WIFI_CheckSavedWifiCredentials(void);
 void DRIVER_WIFI_SetWifiCredentials(uint8_t* ssid, uint8_t* pwd);
+void DRIVER_WIFI_GetWifiCredentials(char* ssid, char* pwd);
+bool DRIVER_WIFI_GetRssi(int* rssi);
 
 bool DRIVER_WIFI_AddCommand(util_dataqueue_item_t* dq_i);
 bool DRIVER_WIFI_AddNotificationTarget(util_dataqueue_t* dq);
 
+void DRIVER_WIFI_GetConnectStats(driver_wifi_connect_stats_t* stats);
+
+uint8_t DRIVER_WIFI_GetScanTable(driver_wifi_scan_entry_t* entries, uint8_t max);
+bool DRIVER_WIFI_GetScanBest(const char* ssid, driver_wifi_scan_entry_t* entry);
+void DRIVER_WIFI_PrintScanTable(void);
+
 #endif
\ No newline at end of file
@@ -11,23 +11,49 @@
 
 #include "util_dataqueue.h"
 
-#define MODULE_API_EXECUTE_PERIOD_S         (30)
+#define MODULE_API_EXECUTE_PERIOD_S         (30)        // Weather Refresh After A Success
 #define MODULE_API_DATAQUEUE_MAX            (4)
-#define MODULE_API_NOTIFICATION_TARGET_MAX  (1)
+#define MODULE_API_NOTIFICATION_TARGET_MAX  (2)
+
+// Retry Policy. Per Endpoint
+// Failure n Retries After BASE * 2^(n - 1) s (Capped At MAX), Half Fixed & Half Random (Jitter)
+// BREAKER_THRESHOLD Failures In A Row Open The Breaker. One Probe Per Cooldown Until A Success
+#define MODULE_API_RETRY_BASE_S             (10)
+#define MODULE_API_RETRY_MAX_S              (300)
+#define MODULE_API_BREAKER_THRESHOLD        (5)
+#define MODULE_API_BREAKER_COOLDOWN_S       (600)
+
+// Result Hand Over To The Executor. Kick Retried With Doubling Delay While Its Queue Is Full
+#define MODULE_API_KICK_RETRY_MIN_MS        (10)
+#define MODULE_API_KICK_RETRY_MAX_MS        (1000)
 
 typedef enum{
-    MODULE_API_NOTIFICATION_TIME_UPDATE = 0,
+    MODULE_API_NOTIFICATION_TIME_UPDATE = UTIL_DATAQUEUE_NOTIFICATION_BASE_MODULE_API,
     MODULE_API_NOTIFICATION_WEATHER_UPDATE,
 }module_api_notification_type_t;
 
 typedef enum{
     MODULE_API_STATE_IDLE = 0,
-    MODULE_API_STATE_GET_TIME,
-    MODULE_API_STATE_GET_WEATHER,
+    MODULE_API_STATE_FETCH,
 }module_api_state_t;
 
+// Api Endpoints. One Fetch Worker Each, So An On-Demand Time Fetch Never Queues Behind Weather
+// Both Run Together On Wifi Connect. Periodic Refresh Is Weather Only
+typedef enum{
+    MODULE_API_FETCH_TIME = 0,
+    MODULE_API_FETCH_WEATHER,
+    MODULE_API_FETCH_MAX
+}module_api_fetch_t;
+
+typedef enum{
+    MODULE_API_BREAKER_CLOSED = 0,
+    MODULE_API_BREAKER_OPEN,
+    MODULE_API_BREAKER_HALF_OPEN,
+}module_api_breaker_t;
+
 bool MODULE_API_Init(void);
 
 bool MODULE_API_AddNotificationTarget(util_dataqueue_t* dq);
+bool MODULE_API_RequestTime(void);
 
 #endif
\ No newline at end of file
@@ -2,45 +2,85 @@
 // JANUARY 1, 2026
 
 #include <time.h>
+#include <math.h>
+#include <sys/param.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "esp_timer.h"
+#include "esp_random.h"
 
 #include "module_api.h"
 #include "driver_api.h"
 #include "driver_wifi.h"
+#include "util_executor.h"
+#include "util_dlog.h"
 #include "define_common_data_types.h"
 #include "define_rtos_tasks.h"
 #include "project_defines.h"
 
+// Retry State. Written By The Owning Fetch Worker Only
+typedef struct{
+    module_api_breaker_t breaker;
+    uint8_t failures_consecutive;
+    TickType_t retry_at;
+    uint32_t next_ms;
+    volatile bool reset_pending;
+    uint32_t count_attempt;
+    uint32_t count_success;
+    uint32_t count_fail;
+    uint32_t count_skip;
+    uint32_t count_trip;
+}module_api_retry_t;
+
+typedef struct{
+    const char* name;
+    TaskHandle_t handle;
+    bool (*run)(void);
+    bool periodic;
+    volatile TickType_t start;              // Last Request. Set By The Requester, Read By The Worker
+    volatile bool schedule_pending;         // Set By The Worker After Each Result. Executor Rearms The Timer
+    module_api_retry_t retry;
+}module_api_fetcher_t;
+
 // Extern Variables
-TaskHandle_t handle_task_module_api;
 
 // Local Variables
 static module_api_state_t s_state;
 static module_api_state_t s_state_prev;
 static rtos_component_type_t s_component_type;
 static util_dataqueue_t s_dataqueue;
+static util_executor_client_t s_executor_client;
 static uint8_t s_notification_targets_count;
 static util_dataqueue_t* s_notification_targets[MODULE_API_NOTIFICATION_TARGET_MAX];
-static esp_timer_handle_t s_timer;
 static driver_api_weather_info_t s_info_weather;
+static bool s_info_weather_valid;
 static driver_api_time_info_t s_info_time;
+static module_api_fetcher_t s_fetchers[MODULE_API_FETCH_MAX];
+static bool s_online;
 
 // Local Functions
 static void s_state_set(module_api_state_t newstate);
 static void s_state_mainiter(void);
 static bool s_notify(util_dataqueue_item_t* dq_i, TickType_t wait);
-static void s_task_function(void *pvParameters);
-static void s_timer_cb(void *arg);
+static void s_on_message(util_dataqueue_item_t* dq_i);
+static void s_timer_cb(void);
+static bool s_fetch_time(void);
+static bool s_fetch_weather(void);
+static void s_weather_item(util_dataqueue_item_t* dq_i);
+static void s_fetch_request(module_api_fetcher_t* f);
+static void s_retry_reset(module_api_retry_t* r);
+static bool s_retry_allow(module_api_retry_t* r);
+static void s_retry_result(module_api_fetcher_t* f, bool ok);
+static uint32_t s_retry_jitter(uint32_t delay_ms);
+static void s_task_fetch(void *pvParameters);
+static void s_schedule(void);
 
 // External Functions
 bool MODULE_API_Init(void)
 {
     // Initialize Module Api
 
-    s_component_type = COMPONENT_TYPE_TASK;
+    s_component_type = COMPONENT_TYPE_EXECUTOR_CLIENT;
     s_state = -1;
     s_state_prev = -1;
     s_state_set(MODULE_API_STATE_IDLE);
@@ -48,36 +88,71 @@ bool MODULE_API_Init(void)
     // Create Data Queue
     UTIL_DATAQUEUE_Create(&s_dataqueue, MODULE_API_DATAQUEUE_MAX);
     s_notification_targets_count = 0;
+    s_online = false;
+
+    // Last Good Weather Persisted By driver_api. Replayed To Each New Target
+    s_info_weather_valid = DRIVER_API_GetWeatherCached(&s_info_weather);
+
+    // Create Fetch Workers
+    // Blocking Http Calls Run Here, Off The Executor, One Worker Per Endpoint
+    s_fetchers[MODULE_API_FETCH_TIME].name = "t-m-api-time";
+    s_fetchers[MODULE_API_FETCH_TIME].run = s_fetch_time;
+    s_fetchers[MODULE_API_FETCH_WEATHER].name = "t-m-api-wthr";
+    s_fetchers[MODULE_API_FETCH_WEATHER].run = s_fetch_weather;
+    s_fetchers[MODULE_API_FETCH_WEATHER].periodic = true;
+    for(uint8_t i = 0; i < MODULE_API_FETCH_MAX; i++){
+        s_retry_reset(&s_fetchers[i].retry);
+        xTaskCreatePinnedToCore(
+            s_task_fetch,
+            s_fetchers[i].name,
+            TASK_STACK_DEPTH_API_FETCH,
+            (void*)&s_fetchers[i],
+            TASK_PRIORITY_API_FETCH,
+            &s_fetchers[i].handle,
+            TASK_CORE_API_FETCH
+        );
+        assert(s_fetchers[i].handle);
+    }
 
-    // Create Timer
-    const esp_timer_create_args_t timer_args = {
-        .callback = &s_timer_cb,
-        .name = "periodic_timer"
-    };
-    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &s_timer));
+    // Register With Executor
+    // One-Shot Executor Timer Drives The Weather Calls. Rearmed After Each Result
+    s_executor_client.name = "m-api";
+    s_executor_client.core = EXECUTOR_CORE_MODULE_API;
+    s_executor_client.dq = &s_dataqueue;
+    s_executor_client.on_message = s_on_message;
+    s_executor_client.on_iter = s_state_mainiter;
+    s_executor_client.on_timer = s_timer_cb;
+    UTIL_EXECUTOR_Register(&s_executor_client);
 
     // Add Notification Targets
     DRIVER_WIFI_AddNotificationTarget(&s_dataqueue);
 
-    // Create Task
-    xTaskCreate(
-        s_task_function,
-        "t-m-api",
-        TASK_STACK_DEPTH_MODULE_API,
-        NULL,
-        TASK_PRIORITY_MODULE_API,
-        &handle_task_module_api
-    );
-
     ESP_LOGI(DEBUG_TAG_MODULE_API, "Type %u. Init", s_component_type);
 
     return true;
 }
 
+bool MODULE_API_RequestTime(void)
+{
+    // Fetch Time Over Http Once
+    // Clock Timezone Offset & Fallback When Sntp Is Unavailable. Result Is Published As MODULE_API_NOTIFICATION_TIME_UPDATE
+    // Dropped By The Worker While The Endpoint Is Backing Off
+
+    if(!s_fetchers[MODULE_API_FETCH_TIME].handle){
+        return false;
+    }
+
+    s_fetch_request(&s_fetchers[MODULE_API_FETCH_TIME]);
+
+    return true;
+}
+
 bool MODULE_API_AddNotificationTarget(util_dataqueue_t* dq)
 {
     // Add Notification Target
 
+    util_dataqueue_item_t dq_i;
+
     if(s_notification_targets_count >= MODULE_API_NOTIFICATION_TARGET_MAX){
         return false;
     }
@@ -85,6 +160,12 @@ bool MODULE_API_AddNotificationTarget(util_dataqueue_t* dq)
     s_notification_targets[s_notification_targets_count] = dq;
     s_notification_targets_count += 1;
 
+    // Paint Cached Weather Without Waiting For The Network
+    if(s_info_weather_valid){
+        s_weather_item(&dq_i);
+        UTIL_DATAQUEUE_MessageQueue(dq, &dq_i, 0);
+    }
+
     return true;
 }
 
@@ -100,48 +181,27 @@ static void s_state_set(module_api_state_t newstate)
     s_state = newstate;
 
     ESP_LOGI(DEBUG_TAG_MODULE_API, "%u -> %u", s_state_prev, s_state);
+
+    // Run New State Without Waiting For The Next Message
+    UTIL_EXECUTOR_Kick(&s_executor_client);
 }
 
 static void s_state_mainiter(void)
 {
     // State Mainiter
     
-    util_dataqueue_item_t dq_i;
-    
+    s_schedule();
+
     switch(s_state)
     {
         case MODULE_API_STATE_IDLE:
             // Do Nothing
             break;
 
-        case MODULE_API_STATE_GET_TIME:
-            if(!DRIVER_API_GetTime(&s_info_time)){
-                ESP_LOGW(DEBUG_TAG_MODULE_API, "Time api fail");
-            }
-
-            // Send Notification
-            dq_i.data_type = DATA_TYPE_NOTIFICATION;
-            dq_i.data = MODULE_API_NOTIFICATION_TIME_UPDATE;
-            dq_i.data_buff.value.timedata.timestamp = s_info_time.timestamp;
-            strcpy(dq_i.data_buff.value.timedata.time_string, s_info_time.time_string);
-            strcpy(dq_i.data_buff.value.timedata.am_pm_string, s_info_time.am_pm_string);
-            strcpy(dq_i.data_buff.value.timedata.date_string, s_info_time.date_string);
-            s_notify(&dq_i, 0);
-
-            s_state_set(MODULE_API_STATE_GET_WEATHER);
-            break;
-
-        case MODULE_API_STATE_GET_WEATHER:
-            if(!DRIVER_API_GetWeather(&s_info_weather)){
-                ESP_LOGW(DEBUG_TAG_MODULE_API, "Weather api fail");
-            }
-
-            // Send Notification
-            dq_i.data_type = DATA_TYPE_NOTIFICATION;
-            dq_i.data = MODULE_API_NOTIFICATION_WEATHER_UPDATE;
-            sprintf(dq_i.data_buff.value.weatherdata.humidity, "%d %%", s_info_weather.humidity);
-            sprintf(dq_i.data_buff.value.weatherdata.temp, "%.0f C", s_info_weather.temp);
-            s_notify(&dq_i, 0);
+        case MODULE_API_STATE_FETCH:
+            // Periodic Refresh Is Weather Only. Time Comes From The Clock (Sntp)
+            // Each Worker Publishes Its Result As Soon As It Arrives
+            s_fetch_request(&s_fetchers[MODULE_API_FETCH_WEATHER]);
 
             s_state_set(MODULE_API_STATE_IDLE);
             break;
@@ -164,65 +224,282 @@ static bool s_notify(util_dataqueue_item_t* dq_i, TickType_t wait)
     return true;
 }
 
-static void s_task_function(void *pvParameters)
+static void s_on_message(util_dataqueue_item_t* dq_i)
 {
-    // Task Function
+    // Executor Message Handler
+
+    UTIL_DLOGI(DEBUG_TAG_MODULE_API, "New In DataQueue. Type %u, Data %u", dq_i->data_type, dq_i->data);
+    
+    if(dq_i->data_type == DATA_TYPE_COMMAND)
+    {
+        
+    }
+    else if(dq_i->data_type == DATA_TYPE_NOTIFICATION)
+    {
+        switch(dq_i->data){
+            case DRIVER_WIFI_NOTIFICATION_GOT_IP:
+                ESP_LOGI(DEBUG_TAG_MODULE_API, "Wifi connected. Starting periodic api @ %us", MODULE_API_EXECUTE_PERIOD_S);
+
+                // New Network. Backoff & Breaker Start Over
+                s_online = true;
+                for(uint8_t i = 0; i < MODULE_API_FETCH_MAX; i++){
+                    s_fetchers[i].retry.reset_pending = true;
+                }
+
+                // Run Once Immidiately. Worker Result Arms The Timer
+                s_timer_cb();
+                break;
+        
+            case DRIVER_WIFI_NOTIFICATION_LOST_IP:
+            case DRIVER_WIFI_NOTIFICATION_DISCONNECTED:
+                ESP_LOGI(DEBUG_TAG_MODULE_API, "Wifi disconnected. Stopping periodic api");
+
+                s_online = false;
+                UTIL_EXECUTOR_TimerStop(&s_executor_client);
+
+                // Kept-Alive Sockets Are Dead Now
+                DRIVER_API_CloseAll();
+                break;
+            
+            default:
+                break;
+        }
+    }
+}
+
+static void s_timer_cb(void)
+{
+    // Executor Timer Callback
+
+    s_state_set(MODULE_API_STATE_FETCH);
+}
+
+static bool s_fetch_time(void)
+{
+    // Fetch Time & Publish
+    // Published On Success Only
 
     util_dataqueue_item_t dq_i;
 
-    ESP_LOGI(DEBUG_TAG_MODULE_API, "Starting task");
+    if(!DRIVER_API_GetTime(&s_info_time)){
+        ESP_LOGW(DEBUG_TAG_MODULE_API, "Time api fail");
+        return false;
+    }
+
+    // Send Notification
+    // Utc Timestamp & Offset Only. The Clock Formats
+    dq_i.data_type = DATA_TYPE_NOTIFICATION;
+    dq_i.data = MODULE_API_NOTIFICATION_TIME_UPDATE;
+    dq_i.data_buff.value.timedata.timestamp = s_info_time.timestamp;
+    dq_i.data_buff.value.timedata.gmt_offset = s_info_time.gmt_offset;
+    s_notify(&dq_i, 0);
+
+    return true;
+}
+
+static bool s_fetch_weather(void)
+{
+    // Fetch Weather & Publish
+    // Published On Success Only. The Screen Keeps The Last Good Values
+
+    util_dataqueue_item_t dq_i;
+    bool ok;
+
+    ok = DRIVER_API_GetWeather(&s_info_weather);
+    if(ok){
+        s_info_weather_valid = true;
+        s_weather_item(&dq_i);
+        s_notify(&dq_i, 0);
+    }else{
+        ESP_LOGW(DEBUG_TAG_MODULE_API, "Weather api fail");
+    }
+
+    DRIVER_API_PrintConnStats();
+
+    return ok;
+}
+
+static void s_weather_item(util_dataqueue_item_t* dq_i)
+{
+    // Build Weather Notification From s_info_weather
+    // Binary Values Only. The Lcd Formats
+
+    dq_i->data_type = DATA_TYPE_NOTIFICATION;
+    dq_i->data = MODULE_API_NOTIFICATION_WEATHER_UPDATE;
+    dq_i->data_buff.value.weatherdata.temp_centi = (int16_t)lround(s_info_weather.temp * 100);
+    dq_i->data_buff.value.weatherdata.humidity = (uint8_t)s_info_weather.humidity;
+    dq_i->data_buff.value.weatherdata.condition_id = s_info_weather.weather_id;
+    dq_i->data_buff.value.weatherdata.sunrise = s_info_weather.sunrise;
+    dq_i->data_buff.value.weatherdata.sunset = s_info_weather.sunset;
+}
+
+static void s_fetch_request(module_api_fetcher_t* f)
+{
+    // Wake Fetch Worker. Any Task
+
+    f->start = xTaskGetTickCount();
+    xTaskNotifyGive(f->handle);
+}
+
+static void s_retry_reset(module_api_retry_t* r)
+{
+    // Clear Backoff & Close Breaker. Counters Are Kept
+
+    r->breaker = MODULE_API_BREAKER_CLOSED;
+    r->failures_consecutive = 0;
+    r->retry_at = xTaskGetTickCount();
+    r->next_ms = MODULE_API_EXECUTE_PERIOD_S * 1000;
+    r->reset_pending = false;
+}
+
+static bool s_retry_allow(module_api_retry_t* r)
+{
+    // Check Whether The Endpoint May Be Called Now
+    // An Expired Open Breaker Lets Exactly One Probe Through
+
+    int32_t remaining = (int32_t)(r->retry_at - xTaskGetTickCount());
+
+    if(r->breaker == MODULE_API_BREAKER_CLOSED && r->failures_consecutive == 0){
+        return true;
+    }
+
+    if(remaining > 0){
+        // Periodic Endpoint Is Rescheduled For When The Backoff Ends
+        r->next_ms = pdTICKS_TO_MS(remaining);
+        return false;
+    }
+
+    if(r->breaker == MODULE_API_BREAKER_OPEN){
+        r->breaker = MODULE_API_BREAKER_HALF_OPEN;
+    }
+
+    return true;
+}
+
+static void s_retry_result(module_api_fetcher_t* f, bool ok)
+{
+    // Update Backoff & Breaker From Call Result
+
+    module_api_retry_t* r = &f->retry;
+    uint32_t delay_s;
+
+    if(ok){
+        if(r->breaker != MODULE_API_BREAKER_CLOSED){
+            ESP_LOGI(DEBUG_TAG_MODULE_API, "%s Breaker Closed", f->name);
+        }
+        r->count_success += 1;
+        s_retry_reset(r);
+        return;
+    }
+
+    r->count_fail += 1;
+    if(r->failures_consecutive < UINT8_MAX){
+        r->failures_consecutive += 1;
+    }
+
+    if(r->breaker == MODULE_API_BREAKER_HALF_OPEN || r->failures_consecutive >= MODULE_API_BREAKER_THRESHOLD){
+        // Failed Probe Or Too Many Failures. Stop Calling For A Cooldown
+        if(r->breaker != MODULE_API_BREAKER_OPEN){
+            r->count_trip += 1;
+        }
+        r->breaker = MODULE_API_BREAKER_OPEN;
+        delay_s = MODULE_API_BREAKER_COOLDOWN_S;
+    }else{
+        delay_s = MODULE_API_RETRY_BASE_S << (r->failures_consecutive - 1);
+        if(delay_s > MODULE_API_RETRY_MAX_S){
+            delay_s = MODULE_API_RETRY_MAX_S;
+        }
+    }
+
+    r->next_ms = s_retry_jitter(delay_s * 1000);
+    r->retry_at = xTaskGetTickCount() + pdMS_TO_TICKS(r->next_ms);
+
+    ESP_LOGW(DEBUG_TAG_MODULE_API, "%s Fail %u In A Row. Breaker %u. Retry In %" PRIu32 " ms",
+        f->name,
+        r->failures_consecutive,
+        r->breaker,
+        r->next_ms
+    );
+}
+
+static uint32_t s_retry_jitter(uint32_t delay_ms)
+{
+    // Equal Jitter. Half The Delay Fixed, Half Random
+    // Spreads Retries So Endpoints (And Devices) Do Not Retry In Lockstep
+
+    return (delay_ms / 2) + (esp_random() % (delay_ms / 2 + 1));
+}
+
+static void s_task_fetch(void *pvParameters)
+{
+    // Api Fetch Worker Task
+    // Notifications Arriving While A Fetch Is In Flight Merge Into One Rerun
+
+    module_api_fetcher_t* f = (module_api_fetcher_t*)pvParameters;
+    module_api_retry_t* r = &f->retry;
+    uint32_t kick_delay_ms;
+    bool ok;
+
+    ESP_LOGI(DEBUG_TAG_MODULE_API, "Starting %s on core %d", f->name, xPortGetCoreID());
 
     while(true){
-        // Check Data Queue
-        if(UTIL_DATAQUEUE_MessageCheck(&s_dataqueue))
-        {
-            if(UTIL_DATAQUEUE_MessageGet(&s_dataqueue, &dq_i, 0))
-            {
-                ESP_LOGI(DEBUG_TAG_MODULE_API, "New In DataQueue. Type %u, Data %u", dq_i.data_type, dq_i.data);
-                
-                if(dq_i.data_type == DATA_TYPE_COMMAND)
-                {
-                    
-                }
-                else if(dq_i.data_type == DATA_TYPE_NOTIFICATION)
-                {
-                    switch(dq_i.data){
-                        case DRIVER_WIFI_NOTIFICATION_GOT_IP:
-                            ESP_LOGI(DEBUG_TAG_MODULE_API, "Wifi connected. Starting periodic api @ %us", MODULE_API_EXECUTE_PERIOD_S);
-
-                            // Run Once Immidiately
-                            s_timer_cb(NULL);
-
-                            // Start Timer
-                            ESP_ERROR_CHECK(esp_timer_start_periodic(s_timer, MODULE_API_EXECUTE_PERIOD_S * 1000 * 1000));
-                            break;
-                    
-                        case DRIVER_WIFI_NOTIFICATION_LOST_IP:
-                        case DRIVER_WIFI_NOTIFICATION_DISCONNECTED:
-                            ESP_LOGI(DEBUG_TAG_MODULE_API, "Wifi disconnected. Stopping periodic api");
-
-                            if(esp_timer_is_active(s_timer)){
-                                ESP_ERROR_CHECK(esp_timer_stop(s_timer));
-                            }
-                            break;
-                        
-                        default:
-                            break;
-                    }
-                }
-            }
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        if(r->reset_pending){
+            s_retry_reset(r);
         }
 
-        // Run State Mainiter
-        s_state_mainiter();
+        // Backing Off. No Radio Time, No Timeout Wait
+        if(!s_retry_allow(r)){
+            r->count_skip += 1;
+            ESP_LOGI(DEBUG_TAG_MODULE_API, "%s Backing Off. Skipped", f->name);
+        }else{
+            r->count_attempt += 1;
+            ok = f->run();
+            s_retry_result(f, ok);
+            ESP_LOGI(DEBUG_TAG_MODULE_API, "%s %s. %" PRIu32 " ms After Request. Attempt %" PRIu32 " Ok %" PRIu32 " Fail %" PRIu32 " Skip %" PRIu32 " Trip %" PRIu32,
+                f->name,
+                ok ? "Done" : "Failed",
+                (uint32_t)pdTICKS_TO_MS(xTaskGetTickCount() - f->start),
+                r->count_attempt,
+                r->count_success,
+                r->count_fail,
+                r->count_skip,
+                r->count_trip
+            );
+        }
 
-        vTaskDelay(pdMS_TO_TICKS(500));
+        // Executor Owns The Timer. Flag Survives A Full Kick Queue & Is Picked Up By Any Later Iteration
+        if(f->periodic){
+            f->schedule_pending = true;
+            kick_delay_ms = MODULE_API_KICK_RETRY_MIN_MS;
+            while(!UTIL_EXECUTOR_Kick(&s_executor_client)){
+                vTaskDelay(pdMS_TO_TICKS(kick_delay_ms));
+                kick_delay_ms = MIN(kick_delay_ms * 2, MODULE_API_KICK_RETRY_MAX_MS);
+            }
+        }
     }
 
     vTaskDelete(NULL);
 }
 
-static void s_timer_cb(void *arg)
+static void s_schedule(void)
 {
-    s_state_set(MODULE_API_STATE_GET_TIME);
-}
\ No newline at end of file
+    // Arm The Weather Timer With The Delay Of The Last Result
+    // Executor Context
+
+    module_api_fetcher_t* f = &s_fetchers[MODULE_API_FETCH_WEATHER];
+
+    if(!f->schedule_pending){
+        return;
+    }
+    f->schedule_pending = false;
+
+    // Result Can Land After The Network Went Down
+    if(!s_online){
+        return;
+    }
+
+    ESP_LOGI(DEBUG_TAG_MODULE_API, "Next weather in %" PRIu32 " ms", f->retry.next_ms);
+    UTIL_EXECUTOR_TimerStart(&s_executor_client, f->retry.next_ms, false);
+}
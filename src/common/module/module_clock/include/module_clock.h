@@ -0,0 +1,52 @@
+// MODULE_CLOCK
+// OCTOBER 19, 2026
+
+#ifndef _MODULE_CLOCK_
+#define _MODULE_CLOCK_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+
+#include "driver_api.h"
+#include "util_dataqueue.h"
+
+// Local Clock
+// Rtc Is Set By Sntp (Http Time Api As Fallback) & Display Time Is Derived Locally,
+// Published Exactly On Every Minute Boundary
+// Timezone Offset Comes From The Time Api For DRIVER_API_TIME_ZONE, Asked Once Per Boot Even When Sntp Syncs
+// (Retried Hourly Until It Answers). DRIVER_API_TIME_ZONE_GMT_OFFSET_S Until Then
+
+#define MODULE_CLOCK_DATAQUEUE_MAX              (4)
+#define MODULE_CLOCK_NOTIFICATION_TARGET_MAX    (1)
+#define MODULE_CLOCK_ADD_TARGET_WAIT_MS         (100)           // Queue Space For The Registration Command
+
+#define MODULE_CLOCK_SNTP_SERVER                "pool.ntp.org"
+#define MODULE_CLOCK_SNTP_TIMEOUT_S             (20)            // Http Fallback If Sntp Has Not Synced By Then
+#define MODULE_CLOCK_EPOCH_VALID_MIN            (1704067200)    // 2024-01-01. Rtc Below This Was Never Set
+#define MODULE_CLOCK_MINUTE_MARGIN_MS           (20)            // Fire Just After The Boundary (Tick Rounding)
+
+typedef enum{
+    MODULE_CLOCK_COMMAND_SNTP_SYNCED = 0,
+    MODULE_CLOCK_COMMAND_ADD_TARGET
+}module_clock_command_type_t;
+
+typedef enum{
+    MODULE_CLOCK_NOTIFICATION_TIME_UPDATE = UTIL_DATAQUEUE_NOTIFICATION_BASE_MODULE_CLOCK,
+}module_clock_notification_type_t;
+
+typedef enum{
+    MODULE_CLOCK_STATE_IDLE = 0,
+    MODULE_CLOCK_STATE_SYNCING,
+    MODULE_CLOCK_STATE_TICK,
+    MODULE_CLOCK_STATE_RUNNING,
+}module_clock_state_t;
+
+bool MODULE_CLOCK_Init(void);
+
+bool MODULE_CLOCK_AddNotificationTarget(util_dataqueue_t* dq);
+bool MODULE_CLOCK_GetTime(driver_api_time_info_t* t_info);
+int32_t MODULE_CLOCK_GetGmtOffset(void);
+
+#endif
@@ -0,0 +1,348 @@
+// MODULE_CLOCK
+// OCTOBER 19, 2026
+
+#include <time.h>
+#include <sys/time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "esp_netif_sntp.h"
+
+#include "module_clock.h"
+#include "module_wifi.h"
+#include "module_api.h"
+#include "util_executor.h"
+#include "define_common_data_types.h"
+#include "define_rtos_tasks.h"
+#include "project_defines.h"
+
+// Extern Variables
+
+// Local Variables
+static module_clock_state_t s_state;
+static module_clock_state_t s_state_prev;
+static rtos_component_type_t s_component_type;
+static util_dataqueue_t s_dataqueue;
+static util_executor_client_t s_executor_client;
+static uint8_t s_notification_targets_count;
+static util_dataqueue_t* s_notification_targets[MODULE_CLOCK_NOTIFICATION_TARGET_MAX];
+static int32_t s_gmt_offset;
+static bool s_gmt_offset_api;                                       // Offset Came From The Time Api
+static bool s_sntp_started;
+static bool s_sntp_synced;
+
+// Local Functions
+static void s_state_set(module_clock_state_t newstate);
+static void s_state_mainiter(void);
+static bool s_notify(util_dataqueue_item_t* dq_i, TickType_t wait);
+static void s_on_message(util_dataqueue_item_t* dq_i);
+static void s_timer_cb(void);
+static void s_sntp_start(void);
+static void s_sntp_sync_cb(struct timeval *tv);
+static void s_minute_timer_start(void);
+static void s_target_add(util_dataqueue_t* dq);
+
+// External Functions
+bool MODULE_CLOCK_Init(void)
+{
+    // Initialize Module Clock
+
+    s_component_type = COMPONENT_TYPE_EXECUTOR_CLIENT;
+    s_state = -1;
+    s_state_prev = -1;
+    s_gmt_offset = DRIVER_API_TIME_ZONE_GMT_OFFSET_S;
+    s_gmt_offset_api = false;
+    s_sntp_started = false;
+    s_sntp_synced = false;
+
+    // Create Data Queue
+    UTIL_DATAQUEUE_Create(&s_dataqueue, MODULE_CLOCK_DATAQUEUE_MAX);
+    s_notification_targets_count = 0;
+
+    // Register With Executor
+    // Executor Timer Drives The Minute Ticks & The Sntp Fallback Timeout
+    s_executor_client.name = "m-clock";
+    s_executor_client.core = EXECUTOR_CORE_MODULE_CLOCK;
+    s_executor_client.dq = &s_dataqueue;
+    s_executor_client.on_message = s_on_message;
+    s_executor_client.on_iter = s_state_mainiter;
+    s_executor_client.on_timer = s_timer_cb;
+    UTIL_EXECUTOR_Register(&s_executor_client);
+
+    // Sntp Is Started On First Ip
+    esp_sntp_config_t config = ESP_NETIF_SNTP_DEFAULT_CONFIG(MODULE_CLOCK_SNTP_SERVER);
+    config.start = false;
+    config.wait_for_sync = false;
+    config.sync_cb = s_sntp_sync_cb;
+    ESP_ERROR_CHECK(esp_netif_sntp_init(&config));
+
+    // Add Notification Targets
+    // Wifi For Ip Events, Api For The Http Time Fallback
+    MODULE_WIFI_AddNotificationTarget(&s_dataqueue);
+    MODULE_API_AddNotificationTarget(&s_dataqueue);
+
+    // Rtc Survives Software Resets. Show Time Immediately If It Is Already Set
+    if(time(NULL) >= MODULE_CLOCK_EPOCH_VALID_MIN){
+        s_state_set(MODULE_CLOCK_STATE_TICK);
+    }else{
+        s_state_set(MODULE_CLOCK_STATE_IDLE);
+    }
+
+    ESP_LOGI(DEBUG_TAG_MODULE_CLOCK, "Type %u. Init", s_component_type);
+
+    return true;
+}
+
+bool MODULE_CLOCK_AddNotificationTarget(util_dataqueue_t* dq)
+{
+    // Add Notification Target
+    // Any Task. Registered On The Executor (s_target_add), Which Owns The Target List
+
+    util_dataqueue_item_t dq_i = {
+        .data_type = DATA_TYPE_COMMAND,
+        .data = MODULE_CLOCK_COMMAND_ADD_TARGET,
+        .data_buff.value.target = dq
+    };
+
+    return UTIL_DATAQUEUE_MessageQueue(&s_dataqueue, &dq_i, pdMS_TO_TICKS(MODULE_CLOCK_ADD_TARGET_WAIT_MS));
+}
+
+bool MODULE_CLOCK_GetTime(driver_api_time_info_t* t_info)
+{
+    // Get Current Utc Time & Timezone Offset
+    // False If The Rtc Has Not Been Set Yet
+
+    time_t now = time(NULL);
+
+    if(now < MODULE_CLOCK_EPOCH_VALID_MIN){
+        return false;
+    }
+
+    t_info->timestamp = (uint32_t)now;
+    t_info->gmt_offset = s_gmt_offset;
+
+    return true;
+}
+
+int32_t MODULE_CLOCK_GetGmtOffset(void)
+{
+    // Get Timezone Offset (Seconds)
+
+    return s_gmt_offset;
+}
+
+static void s_state_set(module_clock_state_t newstate)
+{
+    // Module Clock Set State
+
+    if(s_state == newstate){
+        return;
+    }
+
+    s_state_prev = s_state;
+    s_state = newstate;
+
+    ESP_LOGI(DEBUG_TAG_MODULE_CLOCK, "%u -> %u", s_state_prev, s_state);
+
+    // Run New State Without Waiting For The Next Message
+    UTIL_EXECUTOR_Kick(&s_executor_client);
+}
+
+static void s_state_mainiter(void)
+{
+    // State Mainiter
+
+    util_dataqueue_item_t dq_i;
+    driver_api_time_info_t t_info;
+    uint32_t local;
+
+    switch(s_state)
+    {
+        case MODULE_CLOCK_STATE_IDLE:
+            // Waiting For Network
+            break;
+
+        case MODULE_CLOCK_STATE_SYNCING:
+            // Waiting For Sntp Or Http Time
+            break;
+
+        case MODULE_CLOCK_STATE_TICK:
+            if(MODULE_CLOCK_GetTime(&t_info)){
+                local = t_info.timestamp + t_info.gmt_offset;
+                ESP_LOGI(DEBUG_TAG_MODULE_CLOCK, "Tick %02" PRIu32 ":%02" PRIu32, (local / 3600) % 24, (local / 60) % 60);
+
+                // Send Notification
+                // Binary Time Only. The Lcd Formats
+                dq_i.data_type = DATA_TYPE_NOTIFICATION;
+                dq_i.data = MODULE_CLOCK_NOTIFICATION_TIME_UPDATE;
+                dq_i.data_buff.value.timedata.timestamp = t_info.timestamp;
+                dq_i.data_buff.value.timedata.gmt_offset = t_info.gmt_offset;
+                s_notify(&dq_i, 0);
+            }
+
+            s_minute_timer_start();
+            s_state_set(MODULE_CLOCK_STATE_RUNNING);
+            break;
+
+        case MODULE_CLOCK_STATE_RUNNING:
+            // Waiting For Next Minute
+            break;
+
+        default:
+            break;
+    }
+}
+
+static bool s_notify(util_dataqueue_item_t* dq_i, TickType_t wait)
+{
+    // Send Notification
+
+    for(uint8_t i = 0; i < s_notification_targets_count; i++){
+        if(!UTIL_DATAQUEUE_MessageQueue(s_notification_targets[i], dq_i, wait)){
+            ESP_LOGW(DEBUG_TAG_MODULE_CLOCK, "Message Queue Failed %s", __FILE__);
+        }
+    }
+
+    return true;
+}
+
+static void s_on_message(util_dataqueue_item_t* dq_i)
+{
+    // Executor Message Handler
+
+    struct timeval tv;
+
+    if(dq_i->data_type == DATA_TYPE_COMMAND)
+    {
+        switch(dq_i->data){
+            case MODULE_CLOCK_COMMAND_SNTP_SYNCED:
+                ESP_LOGI(DEBUG_TAG_MODULE_CLOCK, "Sntp synced");
+
+                // Rtc May Have Jumped. Republish & Realign The Minute Timer
+                s_sntp_synced = true;
+                s_state_set(MODULE_CLOCK_STATE_TICK);
+                break;
+
+            case MODULE_CLOCK_COMMAND_ADD_TARGET:
+                s_target_add((util_dataqueue_t*)dq_i->data_buff.value.target);
+                break;
+
+            default:
+                break;
+        }
+    }
+    else if(dq_i->data_type == DATA_TYPE_NOTIFICATION)
+    {
+        switch(dq_i->data){
+            case DRIVER_WIFI_NOTIFICATION_GOT_IP:
+                s_sntp_start();
+
+                // Sntp Carries No Timezone. Offset Of DRIVER_API_TIME_ZONE From The Api
+                if(!s_gmt_offset_api){
+                    MODULE_API_RequestTime();
+                }
+
+                // Fall Back To Http If Sntp Stays Silent
+                if(s_state == MODULE_CLOCK_STATE_IDLE){
+                    UTIL_EXECUTOR_TimerStart(&s_executor_client, MODULE_CLOCK_SNTP_TIMEOUT_S * 1000, false);
+                    s_state_set(MODULE_CLOCK_STATE_SYNCING);
+                }
+                break;
+
+            case MODULE_API_NOTIFICATION_TIME_UPDATE:
+                ESP_LOGI(DEBUG_TAG_MODULE_CLOCK, "Http time. Offset %" PRId32 " s", dq_i->data_buff.value.timedata.gmt_offset);
+
+                // Sntp Is More Accurate. Http Only Sets The Rtc Until Sntp Syncs
+                s_gmt_offset = dq_i->data_buff.value.timedata.gmt_offset;
+                s_gmt_offset_api = true;
+                if(!s_sntp_synced){
+                    tv.tv_sec = dq_i->data_buff.value.timedata.timestamp;
+                    tv.tv_usec = 0;
+                    settimeofday(&tv, NULL);
+                }
+                s_state_set(MODULE_CLOCK_STATE_TICK);
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+static void s_timer_cb(void)
+{
+    // Executor Timer Callback
+
+    if(s_state == MODULE_CLOCK_STATE_SYNCING)
+    {
+        ESP_LOGW(DEBUG_TAG_MODULE_CLOCK, "Sntp timeout. Http fallback");
+
+        MODULE_API_RequestTime();
+        UTIL_EXECUTOR_TimerStart(&s_executor_client, MODULE_CLOCK_SNTP_TIMEOUT_S * 1000, false);
+    }
+    else if(s_state == MODULE_CLOCK_STATE_RUNNING)
+    {
+        // Offset Still The Default. Ask Again On The Hour
+        if(!s_gmt_offset_api && (time(NULL) / 60) % 60 == 0){
+            MODULE_API_RequestTime();
+        }
+        s_state_set(MODULE_CLOCK_STATE_TICK);
+    }
+}
+
+static void s_sntp_start(void)
+{
+    // Start Sntp Once
+    // Lwip Sntp Keeps Polling (CONFIG_LWIP_SNTP_UPDATE_DELAY) Across Reconnects
+
+    if(s_sntp_started){
+        return;
+    }
+
+    ESP_ERROR_CHECK(esp_netif_sntp_start());
+    s_sntp_started = true;
+}
+
+static void s_sntp_sync_cb(struct timeval *tv)
+{
+    // Sntp Sync Callback
+    // Runs In The Lwip Task. Hand Over To The Executor
+
+    util_dataqueue_item_t dq_i = {
+        .data_type = DATA_TYPE_COMMAND,
+        .data = MODULE_CLOCK_COMMAND_SNTP_SYNCED
+    };
+
+    UTIL_DATAQUEUE_MessageQueue(&s_dataqueue, &dq_i, 0);
+}
+
+static void s_minute_timer_start(void)
+{
+    // Arm Timer For The Next Minute Boundary
+
+    struct timeval tv;
+    uint32_t ms;
+
+    gettimeofday(&tv, NULL);
+    ms = (60 - (tv.tv_sec % 60)) * 1000 - (tv.tv_usec / 1000) + MODULE_CLOCK_MINUTE_MARGIN_MS;
+    UTIL_EXECUTOR_TimerStart(&s_executor_client, ms, false);
+}
+
+static void s_target_add(util_dataqueue_t* dq)
+{
+    // Register Notification Target. Executor Only
+
+    if(s_notification_targets_count >= MODULE_CLOCK_NOTIFICATION_TARGET_MAX){
+        ESP_LOGW(DEBUG_TAG_MODULE_CLOCK, "Notification Targets Full");
+        return;
+    }
+
+    s_notification_targets[s_notification_targets_count] = dq;
+    s_notification_targets_count += 1;
+
+    // Republish So A Late Target Does Not Wait For The Next Minute
+    if(s_state == MODULE_CLOCK_STATE_RUNNING){
+        s_state_set(MODULE_CLOCK_STATE_TICK);
+    }
+}
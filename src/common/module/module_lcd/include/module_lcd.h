@@ -10,7 +10,7 @@
 #include <stdbool.h>
 
 #include "driver_lcd.h"
-#include "driver_api.h"
+#include "util_dataqueue.h"
 
 bool MODULE_LCD_Init(void);
 
@@ -18,8 +18,8 @@ bool MODULE_LCD_StartUI(void);
 bool MODULE_LCD_Demo(void);
 
 bool MODULE_LCD_SetIP(char* ip);
-bool MODULE_LCD_SetTime(driver_api_time_info_t* ti);
+bool MODULE_LCD_SetTime(util_dataqueue_timedata_t* td);
 bool MODULE_LCD_SetLocation(char* city_country);
-bool MODULE_LCD_SetWeather(driver_api_weather_info_t* wi);
+bool MODULE_LCD_SetWeather(util_dataqueue_weatherdata_t* wd);
 
 #endif
\ No newline at end of file
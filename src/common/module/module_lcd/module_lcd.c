@@ -15,27 +15,16 @@
 
 // Local Variables
 static rtos_component_type_t s_component_type;
-static TaskHandle_t s_task_handle;
 
 // Local Functions
-static void s_task_function(void *pvParameters);
 
 // External Functions
 bool MODULE_LCD_Init(void)
 {
     // Initialize Module Lcd
 
-    s_component_type = COMPONENT_TYPE_TASK;
-
-    // Create Task
-    xTaskCreate(
-        s_task_function,
-        "t-m-lcd",
-        TASK_STACK_DEPTH_MODULE_LCD,
-        NULL,
-        TASK_PRIORITY_MODULE_LCD,
-        &s_task_handle
-    );
+    // No Task. All Calls Only Forward Commands To The Lvgl Task Of driver_lcd
+    s_component_type = COMPONENT_TYPE_NON_TASK;
 
     ESP_LOGI(DEBUG_TAG_MODULE_LCD, "Type %u. Init", s_component_type);
 
@@ -76,15 +65,16 @@ bool MODULE_LCD_SetIP(char* ip)
     return DRIVER_LCD_AddCommand(&dq_i);
 }
 
-bool MODULE_LCD_SetTime(driver_api_time_info_t* ti)
+bool MODULE_LCD_SetTime(util_dataqueue_timedata_t* td)
 {
     // Set Time Fields
+    // Utc Timestamp & Offset. Formatted In The Lvgl Task
 
     util_dataqueue_item_t dq_i = {
         .data_type = DATA_TYPE_COMMAND,
         .data = DRIVER_LCD_COMMAND_SET_TIME
     };
-    memcpy(&dq_i.data_buff.value.timedata, ti, sizeof(driver_api_time_info_t));
+    dq_i.data_buff.value.timedata = *td;
     return DRIVER_LCD_AddCommand(&dq_i);
 }
 
@@ -100,25 +90,15 @@ bool MODULE_LCD_SetLocation(char* city_country)
     return DRIVER_LCD_AddCommand(&dq_i);
 }
 
-bool MODULE_LCD_SetWeather(driver_api_weather_info_t* wi)
+bool MODULE_LCD_SetWeather(util_dataqueue_weatherdata_t* wd)
 {
     // Set Weather
+    // Binary Values. Formatted In The Lvgl Task
 
     util_dataqueue_item_t dq_i = {
         .data_type = DATA_TYPE_COMMAND,
         .data = DRIVER_LCD_COMMAND_SET_WEATHER
     };
-    memcpy(&dq_i.data_buff.value.weatherdata, wi, sizeof(driver_api_weather_info_t));
+    dq_i.data_buff.value.weatherdata = *wd;
     return DRIVER_LCD_AddCommand(&dq_i);
 }
-
-static void s_task_function(void *pvParameters)
-{
-    // Task Function
-
-    while(true){
-        vTaskDelay(pdMS_TO_TICKS(500));
-    };
-
-    vTaskDelete(NULL);
-}
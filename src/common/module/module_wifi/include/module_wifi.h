@@ -14,9 +14,30 @@
 
 #define MODULE_WIFI_DATAQUEUE_MAX               (3)
 #define MODULE_WIFI_WIFI_CONNECT_TIMEOUT_SEC    (15)
-#define MODULE_WIFI_WIFI_CONNECT_RETRY_MAX      (2)
 #define MODULE_WIFI_NOTIFICATION_TARGET_MAX     (DRIVER_WIFI_NOTIFICATION_TARGET_MAX)
 
+// Connection Manager
+// Known Networks (Added Ones Persisted In Nvs, Plus The Driver Saved & Default Credentials) Are Tried Once
+// Per Round. Last Good Network First, Then Networks Seen By The Last Scan, Then By Priority & Rssi
+// A Failed Round Is Followed By A Bounded Exponential Backoff & A Scan, Then The Next Round
+#define MODULE_WIFI_NETWORKS_MAX                (4)
+#define MODULE_WIFI_NVS_NAMESPACE               "module_wifi"
+#define MODULE_WIFI_NVS_KEY                     "nets"
+#define MODULE_WIFI_PRIORITY_SAVED              (100)       // Credentials The Driver Last Connected With
+#define MODULE_WIFI_PRIORITY_SMARTCONFIG        (100)
+#define MODULE_WIFI_PRIORITY_DEFAULT            (10)        // DEFAULT_WIFI_SSID
+#define MODULE_WIFI_BACKOFF_BASE_MS             (2000)
+#define MODULE_WIFI_BACKOFF_MAX_MS              (60000)
+#define MODULE_WIFI_SCAN_TIMEOUT_S              (15)        // No SCAN_DONE By Then : Scan Counted As Failed
+
+// Roaming
+// Rssi Is Sampled While Online. Several Weak Samples In A Row Trigger A Scan Of The Known Channels
+// Followed By DRIVER_WIFI_COMMAND_ROAM (802.11v Steering Or Directed Move To A Stronger Ap)
+#define MODULE_WIFI_RSSI_PERIOD_S               (10)
+#define MODULE_WIFI_ROAM_RSSI_DBM               (-72)
+#define MODULE_WIFI_ROAM_SAMPLES                (3)
+#define MODULE_WIFI_ROAM_HOLDOFF_S              (60)        // Minimum Time Between Roam Attempts
+
 typedef enum {
     MODULE_WIFI_COMMAND_CONNECT = 0
 }module_wifi_command_type_t;
@@ -24,7 +45,7 @@ typedef enum {
 typedef enum{
     MODULE_WIFI_STATE_IDLE = 0,
     MODULE_WIFI_STATE_CHECK_SAVED_CREDENTIALS,
-    MODULE_WIFI_STATE_CHECK_DEFAULT_CREDENTIALS,
+    MODULE_WIFI_STATE_SELECT,
     MODULE_WIFI_STATE_SCAN,
     MODULE_WIFI_STATE_SCANNING,
     MODULE_WIFI_STATE_SCAN_DONE,
@@ -34,10 +55,20 @@ typedef enum{
     MODULE_WIFI_STATE_CONNECTING,
     MODULE_WIFI_STATE_CONNECTED,
     MODULE_WIFI_STATE_GOT_IP,
+    MODULE_WIFI_STATE_ONLINE,
+    MODULE_WIFI_STATE_ROAM_SCANNING,
+    MODULE_WIFI_STATE_BACKOFF,
     MODULE_WIFI_STATE_LOST_IP,
     MODULE_WIFI_STATE_DISCONNECTED
 }module_wifi_state_t;
 
+typedef struct{
+    char ssid[DRIVER_WIFI_LEN_SSID_MAX + 1];
+    char password[DRIVER_WIFI_LEN_PWD_MAX + 1];
+    uint8_t priority;                   // Higher First
+    bool builtin;                       // Saved / Default Credentials. Not Persisted
+}module_wifi_network_t;
+
 typedef driver_wifi_notification_type_t module_wifi_notification_type_t;
 
 bool MODULE_WIFI_Init(void);
@@ -45,4 +76,8 @@ bool MODULE_WIFI_Init(void);
 bool MODULE_WIFI_AddCommand(util_dataqueue_item_t* dq_i);
 bool MODULE_WIFI_AddNotificationTarget(util_dataqueue_t* dq);
 
+bool MODULE_WIFI_AddNetwork(const char* ssid, const char* password, uint8_t priority);
+bool MODULE_WIFI_RemoveNetwork(const char* ssid);
+void MODULE_WIFI_PrintNetworks(void);
+
 #endif
\ No newline at end of file
@@ -1,67 +1,83 @@
 // MODULE_WIFI
 // SEPTEMBER 6, 2025
 
+#include <string.h>
+#include <stdlib.h>
+#include <sys/param.h>
+
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "esp_timer.h"
+#include "nvs.h"
 
 #include "module_wifi.h"
+#include "util_executor.h"
+#include "util_dlog.h"
 #include "define_common_data_types.h"
 #include "define_rtos_tasks.h"
 #include "project_defines.h"
 
 // Extern Variables
-TaskHandle_t handle_task_module_wifi;
 
 // Local Variables
 static module_wifi_state_t s_state;
 static module_wifi_state_t s_state_prev;
 static util_dataqueue_t s_dataqueue;
+static util_executor_client_t s_executor_client;
 static uint8_t s_notification_targets_count;
 static util_dataqueue_t* s_notification_targets[MODULE_WIFI_NOTIFICATION_TARGET_MAX];
-static module_wifi_state_t s_wifi_credential_source;
 static rtos_component_type_t s_component_type;
-static esp_timer_handle_t s_wifi_timer_handle;
-static uint8_t s_wifi_retry_count;
+static module_wifi_network_t s_networks[MODULE_WIFI_NETWORKS_MAX];
+static uint8_t s_networks_count;
+static portMUX_TYPE s_networks_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t s_networks_tried;                                   // Bit Per Network, This Round
+static char s_network_last[DRIVER_WIFI_LEN_SSID_MAX + 1];           // Last Network That Got An Ip
+static uint8_t s_round;                                             // Failed Rounds In A Row
+static uint8_t s_roam_weak;
+static TickType_t s_roam_last;
 
 // Local Functions
 static bool s_notify(util_dataqueue_item_t* dq_i, TickType_t wait);
 static void s_state_set(module_wifi_state_t newstate);
 static void s_state_mainiter(void);
-static void s_task_function(void *pvParameters);
-static void s_timer_cb(void *arg);
+static void s_on_message(util_dataqueue_item_t* dq_i);
+static void s_timer_cb(void);
+static bool s_network_put(const char* ssid, const char* password, uint8_t priority, bool builtin);
+static void s_networks_builtin(void);
+static void s_networks_load(void);
+static void s_networks_save(void);
+static int8_t s_network_select(module_wifi_network_t* n);
+static void s_rssi_check(void);
+static void s_backoff_start(void);
 
 // External Functions
 bool MODULE_WIFI_Init(void)
 {
     // Initialize Module Wifi
 
-    s_component_type = COMPONENT_TYPE_TASK;
+    s_component_type = COMPONENT_TYPE_EXECUTOR_CLIENT;
     s_state = -1;
     s_state_prev = -1;
     s_state_set(MODULE_WIFI_STATE_IDLE);
 
+    // Known Networks
+    s_networks_count = 0;
+    s_network_last[0] = '\0';
+    s_roam_last = 0;
+    s_networks_load();
+
     // Create Data Queue
     UTIL_DATAQUEUE_Create(&s_dataqueue, MODULE_WIFI_DATAQUEUE_MAX);
     s_notification_targets_count = 0;
 
-    // Create Task
-    xTaskCreate(
-        s_task_function,
-        "t-m-wifi",
-        TASK_STACK_DEPTH_MODULE_WIFI,
-        NULL,
-        TASK_PRIORITY_MODULE_WIFI,
-        &handle_task_module_wifi
-    );
-
-    // Setup Wifi Connect Timer
-    const esp_timer_create_args_t timer_args = {
-        .callback = &s_timer_cb,
-        .arg = (void*)0,     // optional user data
-        .name = "one-shot"
-    };
-    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &s_wifi_timer_handle));
+    // Register With Executor
+    // Executor Timer Is Used As The Wifi Connect Timeout
+    s_executor_client.name = "m-wifi";
+    s_executor_client.core = EXECUTOR_CORE_MODULE_WIFI;
+    s_executor_client.dq = &s_dataqueue;
+    s_executor_client.on_message = s_on_message;
+    s_executor_client.on_iter = s_state_mainiter;
+    s_executor_client.on_timer = s_timer_cb;
+    UTIL_EXECUTOR_Register(&s_executor_client);
 
     // Add Notification Targets
     DRIVER_WIFI_AddNotificationTarget(&s_dataqueue);
@@ -98,6 +114,61 @@ bool MODULE_WIFI_AddNotificationTarget(util_dataqueue_t* dq)
     return true;
 }
 
+bool MODULE_WIFI_AddNetwork(const char* ssid, const char* password, uint8_t priority)
+{
+    // Add Or Update A Known Network & Persist It
+    // Full List : Replaces The Lowest Priority Network If This One Ranks Higher
+
+    if(!s_network_put(ssid, password, priority, false)){
+        ESP_LOGW(DEBUG_TAG_MODULE_WIFI, "Network %s Not Added. List Full", ssid);
+        return false;
+    }
+    s_networks_save();
+
+    return true;
+}
+
+bool MODULE_WIFI_RemoveNetwork(const char* ssid)
+{
+    // Forget A Known Network
+
+    bool found = false;
+
+    taskENTER_CRITICAL(&s_networks_lock);
+    for(uint8_t i = 0; i < s_networks_count; i++){
+        if(strncmp(s_networks[i].ssid, ssid, DRIVER_WIFI_LEN_SSID_MAX) == 0){
+            // Shift The Tail Down So Indices Keep Their Order. Tried Bits Follow Their Networks
+            memmove(&s_networks[i], &s_networks[i + 1], (s_networks_count - i - 1) * sizeof(module_wifi_network_t));
+            s_networks_count -= 1;
+            s_networks_tried = (s_networks_tried & ((1UL << i) - 1)) | ((s_networks_tried >> 1) & ~((1UL << i) - 1));
+            found = true;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL(&s_networks_lock);
+
+    if(found){
+        s_networks_save();
+    }
+
+    return found;
+}
+
+void MODULE_WIFI_PrintNetworks(void)
+{
+    // Print Known Networks
+
+    ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "%u Known Networks (Last Good %s)", s_networks_count, s_network_last);
+    for(uint8_t i = 0; i < s_networks_count; i++){
+        ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "[%u] %-32s | Priority %3u%s",
+            i + 1,
+            s_networks[i].ssid,
+            s_networks[i].priority,
+            s_networks[i].builtin ? " | Builtin" : ""
+        );
+    }
+}
+
 static bool s_notify(util_dataqueue_item_t* dq_i, TickType_t wait)
 {
     // Send Notification
@@ -123,6 +194,9 @@ static void s_state_set(module_wifi_state_t newstate)
     s_state = newstate;
 
     ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "%u -> %u", s_state_prev, s_state);
+
+    // Run New State Without Waiting For The Next Message
+    UTIL_EXECUTOR_Kick(&s_executor_client);
 }
 
 static void s_state_mainiter(void)
@@ -130,6 +204,7 @@ static void s_state_mainiter(void)
     // State Mainiter
     
     util_dataqueue_item_t dq_i;
+    module_wifi_network_t n;
     
     switch(s_state)
     {
@@ -138,48 +213,51 @@ static void s_state_mainiter(void)
             break;
 
         case MODULE_WIFI_STATE_CHECK_SAVED_CREDENTIALS:
-            s_wifi_retry_count = 0;
-            if(DRIVER_WIFI_CheckSavedWifiCredentials())
-            {
-                // WiFi Connect
-                s_wifi_credential_source = MODULE_WIFI_STATE_CHECK_SAVED_CREDENTIALS;
-                s_wifi_retry_count = MODULE_WIFI_WIFI_CONNECT_RETRY_MAX;
-                s_state_set(MODULE_WIFI_STATE_CONNECT);
+            // Start Of A Connection Cycle
+            s_networks_builtin();
+            MODULE_WIFI_PrintNetworks();
+            s_networks_tried = 0;
+            s_round = 0;
+
+            if(s_networks_count == 0){
+                ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "No Wi-Fi Credential Found");
+                s_state_set(MODULE_WIFI_STATE_SCAN);
                 break;
             }
-
-            // No Saved Credentials
-            ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "No Saved Wi-Fi Credential Found");
-            s_state_set(MODULE_WIFI_STATE_CHECK_DEFAULT_CREDENTIALS);
+            s_state_set(MODULE_WIFI_STATE_SELECT);
             break;
 
-        case MODULE_WIFI_STATE_CHECK_DEFAULT_CREDENTIALS:
-            s_wifi_retry_count = 0;
-            #if defined(DEFAULT_WIFI_SSID) && defined(DEFAULT_WIFI_PASSWORD)
-                    ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "Default Wi-Fi Credential Found");
-                    ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "   SSID: %s", DEFAULT_WIFI_SSID);
-                    ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "   Password: %s", DEFAULT_WIFI_PASSWORD);
+        case MODULE_WIFI_STATE_SELECT:
+            if(s_network_select(&n) >= 0){
+                ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "Trying %s (Priority %u)", n.ssid, n.priority);
+                DRIVER_WIFI_SetWifiCredentials((uint8_t*)n.ssid, (uint8_t*)n.password);
+                s_state_set(MODULE_WIFI_STATE_CONNECT);
+                break;
+            }
 
-                    // Set Wifi Credentials
-                    DRIVER_WIFI_SetWifiCredentials((uint8_t*)DEFAULT_WIFI_SSID, (uint8_t*)DEFAULT_WIFI_PASSWORD);
+            if(s_networks_count == 0){
+                s_state_set(MODULE_WIFI_STATE_SCAN);
+                break;
+            }
 
-                    // WiFi Connect
-                    s_wifi_credential_source = MODULE_WIFI_STATE_CHECK_DEFAULT_CREDENTIALS;
-                    s_wifi_retry_count = MODULE_WIFI_WIFI_CONNECT_RETRY_MAX;
-                    s_state_set(MODULE_WIFI_STATE_CONNECT);
-                    break;
-            #endif
+            // Round Failed. Back Off, Then Scan So Visible Networks Go First Next Round
+            s_backoff_start();
+            break;
 
-            // No Default Credentials
-            ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "No Default Wi-Fi Credential Found");
-            s_state_set(MODULE_WIFI_STATE_SCAN);
+        case MODULE_WIFI_STATE_BACKOFF:
+            // Do Nothing
             break;
 
         case MODULE_WIFI_STATE_SCAN:
-            s_wifi_retry_count = 0;
             dq_i.data_type = DATA_TYPE_COMMAND;
             dq_i.data = DRIVER_WIFI_COMMAND_SCAN;
-            DRIVER_WIFI_AddCommand(&dq_i);
+            if(!DRIVER_WIFI_AddCommand(&dq_i)){
+                s_backoff_start();
+                break;
+            }
+
+            // Scan Timeout. Driver Notifies SCAN_DONE Even When The Scan Cannot Start
+            UTIL_EXECUTOR_TimerStart(&s_executor_client, MODULE_WIFI_SCAN_TIMEOUT_S * 1000, false);
             s_state_set(MODULE_WIFI_STATE_SCANNING);
             break;
         
@@ -188,7 +266,12 @@ static void s_state_mainiter(void)
             break;
         
         case MODULE_WIFI_STATE_SCAN_DONE:
-            s_state_set(MODULE_WIFI_STATE_SMARTCONFIG);
+            s_networks_tried = 0;
+            if(s_networks_count == 0){
+                s_state_set(MODULE_WIFI_STATE_SMARTCONFIG);
+                break;
+            }
+            s_state_set(MODULE_WIFI_STATE_SELECT);
             break;
 
         case MODULE_WIFI_STATE_SMARTCONFIG:
@@ -198,9 +281,9 @@ static void s_state_mainiter(void)
             s_state_set(MODULE_WIFI_STATE_SMARTCONFIG_WAITING);
             break;
         
-            case MODULE_WIFI_STATE_SMARTCONFIG_WAITING:
-                // Do Nothing
-                break;
+        case MODULE_WIFI_STATE_SMARTCONFIG_WAITING:
+            // Do Nothing
+            break;
         
         case MODULE_WIFI_STATE_CONNECT:
             dq_i.data_type = DATA_TYPE_COMMAND;
@@ -208,7 +291,7 @@ static void s_state_mainiter(void)
             DRIVER_WIFI_AddCommand(&dq_i);
 
             // Start Timer
-            ESP_ERROR_CHECK(esp_timer_start_once(s_wifi_timer_handle, MODULE_WIFI_WIFI_CONNECT_TIMEOUT_SEC * 1000000));
+            UTIL_EXECUTOR_TimerStart(&s_executor_client, MODULE_WIFI_WIFI_CONNECT_TIMEOUT_SEC * 1000, false);
             s_state_set(MODULE_WIFI_STATE_CONNECTING);
             break;
 
@@ -221,139 +304,406 @@ static void s_state_mainiter(void)
             break;
 
         case MODULE_WIFI_STATE_GOT_IP:
-            // Stop Timer
-            if(esp_timer_is_active(s_wifi_timer_handle)){
-                ESP_ERROR_CHECK(esp_timer_stop(s_wifi_timer_handle));
-            }
-            s_state_set(MODULE_WIFI_STATE_IDLE);
+            // Connect Timeout Becomes The Rssi Monitor
+            UTIL_EXECUTOR_TimerStop(&s_executor_client);
+            s_networks_tried = 0;
+            s_round = 0;
+            s_roam_weak = 0;
+            DRIVER_WIFI_GetWifiCredentials(n.ssid, n.password);
+            strncpy(s_network_last, n.ssid, DRIVER_WIFI_LEN_SSID_MAX);
+            UTIL_EXECUTOR_TimerStart(&s_executor_client, MODULE_WIFI_RSSI_PERIOD_S * 1000, true);
+            s_state_set(MODULE_WIFI_STATE_ONLINE);
+            break;
+
+        case MODULE_WIFI_STATE_ONLINE:
+        case MODULE_WIFI_STATE_ROAM_SCANNING:
+            // Do Nothing
             break;
         
         case MODULE_WIFI_STATE_LOST_IP:
         case MODULE_WIFI_STATE_DISCONNECTED:
-            // Lost IP
-            // Restart Connection Logic
-            // Start New Connection Attempt
-            if(esp_timer_is_active(s_wifi_timer_handle)){
-                ESP_ERROR_CHECK(esp_timer_stop(s_wifi_timer_handle));
-            }
-            s_state_set(MODULE_WIFI_STATE_CHECK_SAVED_CREDENTIALS);
+            // Link Lost. Reconnect Right Away, Last Good Network First
+            UTIL_EXECUTOR_TimerStop(&s_executor_client);
+            s_networks_tried = 0;
+            s_state_set(MODULE_WIFI_STATE_SELECT);
             break;
         
-            default:
-                break;
+        default:
+            break;
     }
 }
 
-static void s_task_function(void *pvParameters)
+static void s_on_message(util_dataqueue_item_t* dq_i)
 {
-    // Task Function
+    // Executor Message Handler
 
-    util_dataqueue_item_t dq_i;
+    util_dataqueue_item_t dq_n;
+    char ssid[DRIVER_WIFI_LEN_SSID_MAX + 1] = {0};
+    char password[DRIVER_WIFI_LEN_PWD_MAX + 1] = {0};
 
-    ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "Starting task");
+    UTIL_DLOGI(DEBUG_TAG_MODULE_WIFI, "New In DataQueue. Type %u, Data %u", dq_i->data_type, dq_i->data);
+    
+    if(dq_i->data_type == DATA_TYPE_COMMAND)
+    {
+        switch(dq_i->data)
+        {
+            case MODULE_WIFI_COMMAND_CONNECT:
+                s_state_set(MODULE_WIFI_STATE_CHECK_SAVED_CREDENTIALS);
+                break;
 
-    while(true){
-        // Check Data Queue
-        if(UTIL_DATAQUEUE_MessageCheck(&s_dataqueue))
+            default:
+                break;
+        }
+    }
+    else if(dq_i->data_type == DATA_TYPE_NOTIFICATION)
+    {
+        // Pass Notification To Module Wifi Notification Targets
+        s_notify(dq_i, 0);
+
+        // Take Action On Notification
+        switch(dq_i->data)
         {
-            if(UTIL_DATAQUEUE_MessageGet(&s_dataqueue, &dq_i, 0))
-            {
-                ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "New In DataQueue. Type %u, Data %u", dq_i.data_type, dq_i.data);
-                
-                if(dq_i.data_type == DATA_TYPE_COMMAND)
-                {
-                    switch(dq_i.data)
-                    {
-                        case MODULE_WIFI_COMMAND_CONNECT:
-                            s_state_set(MODULE_WIFI_STATE_CHECK_SAVED_CREDENTIALS);
-                            break;
-
-                        default:
-                            break;
-                    }
-                }
-                else if(dq_i.data_type == DATA_TYPE_NOTIFICATION)
-                {
-                    // Pass Notification To Module Wifi Notification Targets
-                    s_notify(&dq_i, 0);
-
-                    // Take Action On Notification
-                    switch(dq_i.data)
-                    {
-                        case DRIVER_WIFI_NOTIFICATION_SCAN_DONE:
-                            s_state_set(MODULE_WIFI_STATE_SCAN_DONE);
-                            break;
-
-                        case DRIVER_WIFI_NOTIFICATION_SMARTCONFIG_GOT_CREDENTIALS:
-                            s_state_set(MODULE_WIFI_STATE_CONNECT);
-                            break;
-                        
-                        case DRIVER_WIFI_NOTIFICATION_CONNECTED:
-                            s_state_set(MODULE_WIFI_STATE_CONNECTED);
-                            break;
-                        
-                        case DRIVER_WIFI_NOTIFICATION_GOT_IP:
-                            s_state_set(MODULE_WIFI_STATE_GOT_IP);
-                            break;
-                        
-                        case DRIVER_WIFI_NOTIFICATION_LOST_IP:
-                            // Ignore If Not In Idle State
-                            if(s_state == MODULE_WIFI_STATE_IDLE){
-                                s_state_set(MODULE_WIFI_STATE_LOST_IP);
-                            }
-                            break;
-
-                        case DRIVER_WIFI_NOTIFICATION_DISCONNECTED:
-                            // Ignore If Not In Idle State
-                            if(s_state == MODULE_WIFI_STATE_IDLE){
-                                s_state_set(MODULE_WIFI_STATE_DISCONNECTED);
-                            }
-                            break;
-                        
-                        default:
-                            break;
-                    }
+            case DRIVER_WIFI_NOTIFICATION_SCAN_DONE:
+                if(s_state == MODULE_WIFI_STATE_SCANNING){
+                    UTIL_EXECUTOR_TimerStop(&s_executor_client);
+                    s_state_set(MODULE_WIFI_STATE_SCAN_DONE);
+                }else if(s_state == MODULE_WIFI_STATE_ROAM_SCANNING){
+                    // Scan Table Is Fresh. Driver Decides Whether & Where To Move
+                    dq_n.data_type = DATA_TYPE_COMMAND;
+                    dq_n.data = DRIVER_WIFI_COMMAND_ROAM;
+                    DRIVER_WIFI_AddCommand(&dq_n);
+                    s_roam_last = xTaskGetTickCount();
+                    UTIL_EXECUTOR_TimerStart(&s_executor_client, MODULE_WIFI_RSSI_PERIOD_S * 1000, true);
+                    s_state_set(MODULE_WIFI_STATE_ONLINE);
                 }
-            }
-        }
+                break;
 
-        // Run State Mainiter
-        s_state_mainiter();
+            case DRIVER_WIFI_NOTIFICATION_SMARTCONFIG_GOT_CREDENTIALS:
+                // Remember It & Try It First
+                DRIVER_WIFI_GetWifiCredentials(ssid, password);
+                MODULE_WIFI_AddNetwork(ssid, password, MODULE_WIFI_PRIORITY_SMARTCONFIG);
+                strncpy(s_network_last, ssid, DRIVER_WIFI_LEN_SSID_MAX);
+                s_networks_tried = 0;
+                s_state_set(MODULE_WIFI_STATE_SELECT);
+                break;
+            
+            case DRIVER_WIFI_NOTIFICATION_CONNECTED:
+                // Also Sent After An 802.11v Roam While Online
+                if(s_state == MODULE_WIFI_STATE_CONNECTING){
+                    s_state_set(MODULE_WIFI_STATE_CONNECTED);
+                }
+                break;
+            
+            case DRIVER_WIFI_NOTIFICATION_GOT_IP:
+                if(s_state != MODULE_WIFI_STATE_ONLINE && s_state != MODULE_WIFI_STATE_ROAM_SCANNING){
+                    s_state_set(MODULE_WIFI_STATE_GOT_IP);
+                }
+                break;
+            
+            case DRIVER_WIFI_NOTIFICATION_LOST_IP:
+            case DRIVER_WIFI_NOTIFICATION_DISCONNECTED:
+                if(s_state == MODULE_WIFI_STATE_ONLINE || s_state == MODULE_WIFI_STATE_ROAM_SCANNING){
+                    s_state_set((dq_i->data == DRIVER_WIFI_NOTIFICATION_LOST_IP) ? MODULE_WIFI_STATE_LOST_IP : MODULE_WIFI_STATE_DISCONNECTED);
+                    break;
+                }
 
-        vTaskDelay(pdMS_TO_TICKS(500));
+                // Attempt Failed (Driver Already Tried Its Full Scan Fallback). Next Network Without Waiting For The Timeout
+                if(s_state == MODULE_WIFI_STATE_CONNECTING || s_state == MODULE_WIFI_STATE_CONNECTED){
+                    UTIL_EXECUTOR_TimerStop(&s_executor_client);
+                    s_state_set(MODULE_WIFI_STATE_SELECT);
+                }
+                break;
+            
+            default:
+                break;
+        }
     }
-
-    vTaskDelete(NULL);
 }
 
-static void s_timer_cb(void *arg)
+static void s_timer_cb(void)
 {
-    // Timer Callback
-
-    if(s_wifi_retry_count <= MODULE_WIFI_WIFI_CONNECT_RETRY_MAX){
-        s_wifi_retry_count += 1;
-        s_state_set(MODULE_WIFI_STATE_CONNECT);
-        return;
-    }
+    // Executor Timer Callback
+    // Connect Timeout, Scan Timeout, Backoff Or Rssi Monitor Depending On State
 
-    // Retries Exhausted
-    // Resume Wifi Credentials State Machine
-    ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "%u Connect Retries Exhausted", MODULE_WIFI_WIFI_CONNECT_RETRY_MAX);
-    switch(s_wifi_credential_source)
+    switch(s_state)
     {
-        case MODULE_WIFI_STATE_CHECK_SAVED_CREDENTIALS:
-            s_state_set(MODULE_WIFI_STATE_CHECK_DEFAULT_CREDENTIALS);
+        case MODULE_WIFI_STATE_CONNECTING:
+        case MODULE_WIFI_STATE_CONNECTED:
+            ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "Connect Timeout");
+            s_state_set(MODULE_WIFI_STATE_SELECT);
             break;
-        
-        case MODULE_WIFI_STATE_CHECK_DEFAULT_CREDENTIALS:
+
+        case MODULE_WIFI_STATE_BACKOFF:
             s_state_set(MODULE_WIFI_STATE_SCAN);
             break;
-        
-        case MODULE_WIFI_STATE_SMARTCONFIG:
+
+        case MODULE_WIFI_STATE_SCANNING:
+            ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "Scan Timeout");
+            s_backoff_start();
             break;
-        
+
+        case MODULE_WIFI_STATE_ROAM_SCANNING:
+            // Stay On The Current Ap. Holdoff Applies Before The Next Roam Scan
+            ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "Roam Scan Timeout");
+            s_roam_last = xTaskGetTickCount();
+            UTIL_EXECUTOR_TimerStart(&s_executor_client, MODULE_WIFI_RSSI_PERIOD_S * 1000, true);
+            s_state_set(MODULE_WIFI_STATE_ONLINE);
+            break;
+
+        case MODULE_WIFI_STATE_ONLINE:
+            s_rssi_check();
+            break;
+
         default:
-            s_state_set(MODULE_WIFI_STATE_CHECK_SAVED_CREDENTIALS);
             break;
     }
-}
\ No newline at end of file
+}
+
+static bool s_network_put(const char* ssid, const char* password, uint8_t priority, bool builtin)
+{
+    // Insert Or Update A Network
+    // An Explicitly Added Network Stops Being Builtin. Builtin Credentials Never Touch An Added One,
+    // Neither By Update Nor By Eviction (Full List Only Evicts Another Builtin Entry)
+
+    int8_t slot = -1;
+
+    taskENTER_CRITICAL(&s_networks_lock);
+    for(uint8_t i = 0; i < s_networks_count; i++){
+        if(strncmp(s_networks[i].ssid, ssid, DRIVER_WIFI_LEN_SSID_MAX) == 0){
+            if(builtin && !s_networks[i].builtin){
+                taskEXIT_CRITICAL(&s_networks_lock);
+                return true;
+            }
+            slot = i;
+            break;
+        }
+    }
+    if(slot < 0 && s_networks_count < MODULE_WIFI_NETWORKS_MAX){
+        slot = s_networks_count++;
+    }
+    if(slot < 0){
+        for(uint8_t i = 0; i < s_networks_count; i++){
+            if(builtin && !s_networks[i].builtin){
+                continue;
+            }
+            if(slot < 0 || s_networks[i].priority < s_networks[slot].priority){
+                slot = i;
+            }
+        }
+        if(slot >= 0 && s_networks[slot].priority >= priority){
+            slot = -1;
+        }
+    }
+    if(slot >= 0){
+        memset(&s_networks[slot], 0, sizeof(module_wifi_network_t));
+        strncpy(s_networks[slot].ssid, ssid, DRIVER_WIFI_LEN_SSID_MAX);
+        strncpy(s_networks[slot].password, password, DRIVER_WIFI_LEN_PWD_MAX);
+        s_networks[slot].priority = priority;
+        s_networks[slot].builtin = builtin;
+    }
+    taskEXIT_CRITICAL(&s_networks_lock);
+
+    return (slot >= 0);
+}
+
+static void s_networks_builtin(void)
+{
+    // Merge Driver Saved & Default Credentials Into The Known Networks
+
+    char ssid[DRIVER_WIFI_LEN_SSID_MAX + 1] = {0};
+    char password[DRIVER_WIFI_LEN_PWD_MAX + 1] = {0};
+
+    if(DRIVER_WIFI_CheckSavedWifiCredentials()){
+        DRIVER_WIFI_GetWifiCredentials(ssid, password);
+        s_network_put(ssid, password, MODULE_WIFI_PRIORITY_SAVED, true);
+
+        // Driver Saves The Credentials Of Every Connect, So This Is The Last Good Network After Boot
+        if(s_network_last[0] == '\0'){
+            strncpy(s_network_last, ssid, DRIVER_WIFI_LEN_SSID_MAX);
+        }
+    }
+
+    #if defined(DEFAULT_WIFI_SSID) && defined(DEFAULT_WIFI_PASSWORD)
+    s_network_put(DEFAULT_WIFI_SSID, DEFAULT_WIFI_PASSWORD, MODULE_WIFI_PRIORITY_DEFAULT, true);
+    #endif
+}
+
+static void s_networks_load(void)
+{
+    // Restore Added Networks From Nvs
+
+    module_wifi_network_t* nets;
+    nvs_handle_t handle;
+    size_t len = MODULE_WIFI_NETWORKS_MAX * sizeof(module_wifi_network_t);
+
+    if(nvs_open(MODULE_WIFI_NVS_NAMESPACE, NVS_READONLY, &handle) != ESP_OK){
+        return;
+    }
+
+    nets = (module_wifi_network_t*)malloc(len);
+    if(nets && nvs_get_blob(handle, MODULE_WIFI_NVS_KEY, nets, &len) == ESP_OK && (len % sizeof(module_wifi_network_t)) == 0){
+        for(uint8_t i = 0; i < len / sizeof(module_wifi_network_t); i++){
+            s_network_put(nets[i].ssid, nets[i].password, nets[i].priority, false);
+        }
+    }
+    nvs_close(handle);
+    free(nets);
+
+    ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "%u Networks Restored", s_networks_count);
+}
+
+static void s_networks_save(void)
+{
+    // Persist Added (Non Builtin) Networks
+
+    module_wifi_network_t* nets;
+    nvs_handle_t handle;
+    uint8_t count = 0;
+
+    nets = (module_wifi_network_t*)malloc(MODULE_WIFI_NETWORKS_MAX * sizeof(module_wifi_network_t));
+    if(!nets){
+        return;
+    }
+
+    taskENTER_CRITICAL(&s_networks_lock);
+    for(uint8_t i = 0; i < s_networks_count; i++){
+        if(!s_networks[i].builtin){
+            nets[count++] = s_networks[i];
+        }
+    }
+    taskEXIT_CRITICAL(&s_networks_lock);
+
+    if(nvs_open(MODULE_WIFI_NVS_NAMESPACE, NVS_READWRITE, &handle) != ESP_OK){
+        ESP_LOGW(DEBUG_TAG_MODULE_WIFI, "Networks Nvs Open Fail");
+        free(nets);
+        return;
+    }
+    if(count){
+        nvs_set_blob(handle, MODULE_WIFI_NVS_KEY, nets, count * sizeof(module_wifi_network_t));
+    }else{
+        nvs_erase_key(handle, MODULE_WIFI_NVS_KEY);
+    }
+    nvs_commit(handle);
+    nvs_close(handle);
+    free(nets);
+
+    ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "%u Networks Saved", count);
+}
+
+static int8_t s_network_select(module_wifi_network_t* n)
+{
+    // Pick The Next Untried Network Of This Round
+    // Last Good Network, Then Visible In The Scan Table, Then Priority, Then Rssi
+    // Returns Its Index (Copied To n) Or -1 When All Were Tried
+
+    driver_wifi_scan_entry_t e;
+    int32_t score;
+    int32_t score_best = -1;
+    int8_t best = -1;
+
+    for(uint8_t i = 0; i < s_networks_count; i++){
+        if(s_networks_tried & (1 << i)){
+            continue;
+        }
+
+        taskENTER_CRITICAL(&s_networks_lock);
+        *n = s_networks[i];
+        taskEXIT_CRITICAL(&s_networks_lock);
+
+        score = n->priority << 8;
+        if(DRIVER_WIFI_GetScanBest(n->ssid, &e)){
+            score += (1 << 16) + (e.rssi + 128);
+        }
+        if(strncmp(n->ssid, s_network_last, DRIVER_WIFI_LEN_SSID_MAX) == 0){
+            score += (1 << 17);
+        }
+
+        if(score > score_best){
+            score_best = score;
+            best = i;
+        }
+    }
+
+    if(best < 0){
+        return -1;
+    }
+
+    taskENTER_CRITICAL(&s_networks_lock);
+    s_networks_tried |= (1 << best);
+    *n = s_networks[best];
+    taskEXIT_CRITICAL(&s_networks_lock);
+
+    return best;
+}
+
+static void s_rssi_check(void)
+{
+    // Rssi Monitor (Online)
+    // Sustained Weak Signal Starts A Roam Scan Of The Channels The Current Ssid Was Seen On
+
+    driver_wifi_scan_entry_t* entries;
+    util_dataqueue_item_t dq_i;
+    char ssid[DRIVER_WIFI_LEN_SSID_MAX + 1] = {0};
+    char password[DRIVER_WIFI_LEN_PWD_MAX + 1] = {0};
+    uint16_t mask = 0;
+    uint8_t count;
+    int rssi;
+
+    if(!DRIVER_WIFI_GetRssi(&rssi)){
+        return;
+    }
+
+    if(rssi >= MODULE_WIFI_ROAM_RSSI_DBM){
+        s_roam_weak = 0;
+        return;
+    }
+
+    // Keeps Counting Through The Holdoff. Clamped So It Cannot Wrap
+    s_roam_weak = MIN(s_roam_weak + 1, MODULE_WIFI_ROAM_SAMPLES);
+    if(s_roam_weak < MODULE_WIFI_ROAM_SAMPLES){
+        return;
+    }
+    if(s_roam_last && (xTaskGetTickCount() - s_roam_last) < pdMS_TO_TICKS(MODULE_WIFI_ROAM_HOLDOFF_S * 1000)){
+        return;
+    }
+    s_roam_weak = 0;
+
+    // Known Channels Of This Ssid. None Known : All Channels
+    entries = (driver_wifi_scan_entry_t*)malloc(DRIVER_WIFI_SCAN_TABLE_MAX * sizeof(driver_wifi_scan_entry_t));
+    if(entries){
+        DRIVER_WIFI_GetWifiCredentials(ssid, password);
+        count = DRIVER_WIFI_GetScanTable(entries, DRIVER_WIFI_SCAN_TABLE_MAX);
+        for(uint8_t i = 0; i < count; i++){
+            if(strncmp(entries[i].ssid, ssid, DRIVER_WIFI_LEN_SSID_MAX) == 0){
+                mask |= (1 << entries[i].channel);
+            }
+        }
+        free(entries);
+    }
+
+    ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "Weak Signal %d dBm. Roam Scan Channels 0x%04x", rssi, mask);
+
+    dq_i.data_type = DATA_TYPE_COMMAND;
+    dq_i.data = DRIVER_WIFI_COMMAND_SCAN_CHANNELS;
+    dq_i.data_buff.value.channel_mask = mask;
+    if(!DRIVER_WIFI_AddCommand(&dq_i)){
+        return;
+    }
+
+    // Rssi Monitor Becomes The Roam Scan Timeout. Restarted Once Back Online
+    UTIL_EXECUTOR_TimerStart(&s_executor_client, MODULE_WIFI_SCAN_TIMEOUT_S * 1000, false);
+    s_state_set(MODULE_WIFI_STATE_ROAM_SCANNING);
+}
+
+static void s_backoff_start(void)
+{
+    // Round Or Scan Failed. Wait Before The Next Scan, Doubling Up To MODULE_WIFI_BACKOFF_MAX_MS
+
+    uint32_t backoff_ms;
+
+    s_round = MIN(s_round + 1, 16);
+    backoff_ms = MIN((uint32_t)MODULE_WIFI_BACKOFF_BASE_MS << (s_round - 1), MODULE_WIFI_BACKOFF_MAX_MS);
+    ESP_LOGI(DEBUG_TAG_MODULE_WIFI, "Round %u Failed. Retry In %" PRIu32 " ms", s_round, backoff_ms);
+    UTIL_EXECUTOR_TimerStart(&s_executor_client, backoff_ms, false);
+    s_state_set(MODULE_WIFI_STATE_BACKOFF);
+}
@@ -8,7 +8,8 @@
 
 typedef enum{
     COMPONENT_TYPE_NON_TASK = 0,
-    COMPONENT_TYPE_TASK
+    COMPONENT_TYPE_TASK,
+    COMPONENT_TYPE_EXECUTOR_CLIENT
 }rtos_component_type_t;
 
 #endif
\ No newline at end of file
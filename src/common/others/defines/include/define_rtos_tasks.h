@@ -8,19 +8,49 @@
 #include "freertos/task.h"
 #include "esp_log.h"
 
+// Task Placement Plan
+// Core 0 : Wifi Task, Lwip Tcpip Task (Pinned In sdkconfig), esp_timer Task, Api Fetch Workers, Executor Core 0
+// Core 1 : Lvgl Task, Rgb Panel Isr (Vsync & Bounce Buffer Refill), Executor Core 1
+// Blocking Http / Tls Stays With The Network Stack. Executors Run Below Lvgl So Bursts Never Delay A Frame
+
 // Task Priority
-#define TASK_PRIORITY_DRIVER_WIFI           (2)
-#define TASK_PRIORITY_MODULE_WIFI           (2)
-#define TASK_PRIORITY_MODULE_LCD            (2)
-#define TASK_PRIORITY_MODULE_API            (2)
+#define TASK_PRIORITY_EXECUTOR              (2)
+#define TASK_PRIORITY_API_FETCH             (2)
 #define TASK_PRIORITY_LVGL                  (5)
+#define TASK_PRIORITY_TRACE_EXPORT          (1)
+#define TASK_PRIORITY_BOOT_STEP             (3)
+#define TASK_PRIORITY_DLOG                  (1)
+
+// Task Core Affinity
+#define TASK_CORE_LVGL                      (1)
+#define TASK_CORE_LCD_PANEL_ISR             (1)
+#define TASK_CORE_API_FETCH                 (0)
+#define TASK_CORE_BOOT_STEP                 (0)         // Network Init With The Wifi & Lwip Tasks. Lcd Step Uses TASK_CORE_LCD_PANEL_ISR
 
-// Task Stack Depth
-#define TASK_STACK_DEPTH_DRIVER_WIFI        (4096)
-#define TASK_STACK_DEPTH_MODULE_WIFI        (4096)
-#define TASK_STACK_DEPTH_MODULE_LCD         (4096)
-#define TASK_STACK_DEPTH_MODULE_API         (4096)
+// Task Stack Depth (Bytes)
+// Executor Workers Replace The Former t-d-wifi, t-m-wifi, t-m-lcd & t-m-api Tasks (4 x 4096)
+// Workers Are Created On First Client Registration. Blocking Http Runs In The Api Fetch Workers Instead
+#define TASK_STACK_DEPTH_EXECUTOR_CORE0     (4096)
+#define TASK_STACK_DEPTH_EXECUTOR_CORE1     (4096)
+#define TASK_STACK_DEPTH_API_FETCH          (3584)      // One Per Api Endpoint. Blocking Http, Streaming Parser (State Is Static), Nvs Cache Write
 #define TASK_STACK_DEPTH_LVGL               (4 * 4096)
+#define TASK_STACK_DEPTH_LCD_PANEL_SETUP    (4096)      // One Shot. Deleted After Panel Setup
+#define TASK_STACK_DEPTH_TRACE_EXPORT       (4096)      // One Shot. Only With CONFIG_TRACE_ENABLE
+#define TASK_STACK_DEPTH_BOOT_STEP          (4096)      // One Per Boot Step. Deleted When The Step Is Done
+#define TASK_STACK_DEPTH_DLOG               (3072)      // Deferred Log Drain. One Line Buffer + snprintf
+
+// Task Stack Budget
+// Sizes Above Are Upper Bounds. CONFIG_STACK_BUDGET_ENABLE Prints Measured Use & Recommended Values
+// Stack In Psram (CONFIG_TASK_STACKS_IN_PSRAM). Only Tasks That Never Write Flash, Never Delete Themselves
+// & Are Not Timing Critical. Executor, Api Fetch (Nvs Cache) & Boot Steps (Nvs, Spiffs) Stay Internal
+#define TASK_STACK_PSRAM_DLOG               (true)
+
+// Executor Client Core
+#define EXECUTOR_CORE_DRIVER_WIFI           (0)
+#define EXECUTOR_CORE_MODULE_WIFI           (0)
+#define EXECUTOR_CORE_MODULE_API            (0)
+#define EXECUTOR_CORE_MODULE_CLOCK          (0)
+#define EXECUTOR_CORE_MAIN                  (0)
 
 // Task Debug Tag
 #define DEBUG_TAG_DRIVER_CHIPINFO       ("D.ChipInfo")
@@ -32,11 +62,14 @@
 #define DEBUG_TAG_MODULE_WIFI           ("M.Wifi")
 #define DEBUG_TAG_MODULE_LCD            ("M.Lcd")
 #define DEBUG_TAG_MODULE_API            ("M.api")
+#define DEBUG_TAG_MODULE_CLOCK          ("M.Clock")
+#define DEBUG_TAG_UTIL_EXECUTOR         ("U.Executor")
+#define DEBUG_TAG_UTIL_TASKPLAN         ("U.TaskPlan")
+#define DEBUG_TAG_UTIL_TRACE            ("U.Trace")
+#define DEBUG_TAG_UTIL_BOOT             ("U.Boot")
+#define DEBUG_TAG_UTIL_DLOG             ("U.Dlog")
 
 // Task Handles
-extern TaskHandle_t handle_task_driver_wifi;
 extern TaskHandle_t handle_task_driver_lcd;
-extern TaskHandle_t handle_task_module_wifi;
-extern TaskHandle_t handle_task_module_api;
 
 #endif
\ No newline at end of file
@@ -0,0 +1,55 @@
+// UTIL BOOT
+// OCTOBER 19, 2026
+
+#ifndef _UTIL_BOOT_
+#define _UTIL_BOOT_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+
+#include "freertos/FreeRTOS.h"
+
+// Boot Orchestrator
+// Each Step Runs In Its Own Short Lived Task As Soon As The Readiness Bits It Requires Are Set
+// Independent Steps Therefore Initialize In Parallel. Readiness Replaces Fixed Boot Delays
+// A Failed Step Marks What It Provides As Failed. Steps Requiring It Are Skipped & Fail In Turn
+
+#define UTIL_BOOT_STEPS_MAX             (8)
+
+// Readiness Bits
+#define UTIL_BOOT_READY_LCD             (1 << 0)    // Panel & Lvgl Up
+#define UTIL_BOOT_READY_SPIFFS          (1 << 1)
+#define UTIL_BOOT_READY_NET             (1 << 2)    // Netif, Event Loop & Wifi
+#define UTIL_BOOT_READY_API             (1 << 3)
+#define UTIL_BOOT_READY_CLOCK           (1 << 4)
+#define UTIL_BOOT_READY_UI              (1 << 5)    // SquareLine Ui Loaded (driver_lcd)
+#define UTIL_BOOT_READY_FIRST_PIXEL     (1 << 6)    // First Lvgl Frame Flushed (driver_lcd)
+#define UTIL_BOOT_READY_FIRST_DATA      (1 << 7)    // First Time / Weather Sent To The Display
+#define UTIL_BOOT_READY_BITS            (8)
+
+typedef struct{
+    const char* name;
+    bool (*run)(void);
+    BaseType_t core;                // Step Task Core. Init Code Allocates Its Isrs On The Calling Core
+    uint32_t requires;              // Readiness Bits Waited For Before run
+    uint32_t provides;              // Readiness Bits Set After A Successful run, Marked Failed Otherwise
+
+    // Orchestrator Internal
+    int64_t start_us;
+    int64_t end_us;
+    bool ok;
+    bool skipped;                   // A Requirement Failed, run Never Called
+}util_boot_step_t;
+
+bool UTIL_BOOT_Init(void);
+bool UTIL_BOOT_Run(util_boot_step_t* steps, uint8_t count);
+
+void UTIL_BOOT_Signal(uint32_t bits);
+void UTIL_BOOT_Fail(uint32_t bits);
+bool UTIL_BOOT_Wait(uint32_t bits, TickType_t wait);
+
+void UTIL_BOOT_PrintReport(void);
+
+#endif
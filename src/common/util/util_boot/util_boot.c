@@ -0,0 +1,286 @@
+// UTIL BOOT
+// OCTOBER 19, 2026
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+#include "util_boot.h"
+#include "util_taskplan.h"
+#include "define_common_data_types.h"
+#include "define_rtos_tasks.h"
+
+#define UTIL_BOOT_RUN_TIMEOUT_MS        (15000)
+#define UTIL_BOOT_FAILED_SHIFT          (UTIL_BOOT_READY_BITS)      // Failed Bits Sit Above The Readiness Bits In s_ready
+
+// Extern Variables
+
+// Local Variables
+static EventGroupHandle_t s_ready;
+static SemaphoreHandle_t s_done;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t s_ready_seen;
+static uint32_t s_failed;
+static int64_t s_ready_us[UTIL_BOOT_READY_BITS];
+static util_boot_step_t* s_steps;
+static uint8_t s_steps_count;
+static const char* s_ready_names[UTIL_BOOT_READY_BITS] = {
+    "Lcd", "Spiffs", "Net", "Api", "Clock", "Ui", "First Pixel", "First Data"
+};
+
+// Local Functions
+static int8_t s_wait(uint32_t bits, TickType_t wait);
+static void s_task_step(void* arg);
+
+// External Functions
+bool UTIL_BOOT_Init(void)
+{
+    // Initialize Boot Orchestrator
+    // Call Once, Early In app_main
+
+    s_ready = xEventGroupCreate();
+    s_done = xSemaphoreCreateCounting(UTIL_BOOT_STEPS_MAX, 0);
+    if(!s_ready || !s_done){
+        return false;
+    }
+
+    s_ready_seen = 0;
+    s_failed = 0;
+    s_steps = NULL;
+    s_steps_count = 0;
+
+    ESP_LOGI(DEBUG_TAG_UTIL_BOOT, "Init At %" PRId64 " ms", esp_timer_get_time() / 1000);
+
+    return true;
+}
+
+bool UTIL_BOOT_Run(util_boot_step_t* steps, uint8_t count)
+{
+    // Start Every Step & Wait For All Of Them
+    // Steps Wait On Their Own Requirements, So Table Order Only Sets Task Creation Order
+
+    TickType_t deadline;
+    TickType_t now;
+    uint8_t done = 0;
+    bool ok = true;
+
+    if(!s_ready || count > UTIL_BOOT_STEPS_MAX){
+        return false;
+    }
+
+    s_steps = steps;
+    s_steps_count = count;
+
+    for(uint8_t i = 0; i < count; i++){
+        steps[i].start_us = 0;
+        steps[i].end_us = 0;
+        steps[i].ok = false;
+        steps[i].skipped = false;
+        if(xTaskCreatePinnedToCore(
+            s_task_step,
+            steps[i].name,
+            TASK_STACK_DEPTH_BOOT_STEP,
+            (void*)&steps[i],
+            TASK_PRIORITY_BOOT_STEP,
+            NULL,
+            steps[i].core
+        ) != pdPASS){
+            ESP_LOGE(DEBUG_TAG_UTIL_BOOT, "Step %s Task Create Fail", steps[i].name);
+            // Dependents Are Skipped Instead Of Waiting Forever
+            UTIL_BOOT_Fail(steps[i].provides);
+            done += 1;
+            ok = false;
+        }
+    }
+
+    deadline = xTaskGetTickCount() + pdMS_TO_TICKS(UTIL_BOOT_RUN_TIMEOUT_MS);
+    while(done < count){
+        now = xTaskGetTickCount();
+        if(now >= deadline || xSemaphoreTake(s_done, deadline - now) != pdTRUE){
+            for(uint8_t i = 0; i < count; i++){
+                if(steps[i].end_us == 0){
+                    ESP_LOGE(DEBUG_TAG_UTIL_BOOT, "Step %s Not Done After %u ms", steps[i].name, UTIL_BOOT_RUN_TIMEOUT_MS);
+                }
+            }
+            return false;
+        }
+        done += 1;
+    }
+
+    for(uint8_t i = 0; i < count; i++){
+        ok = ok && steps[i].ok;
+    }
+
+    return ok;
+}
+
+void UTIL_BOOT_Signal(uint32_t bits)
+{
+    // Set Readiness Bits
+    // First Time Each Bit Is Set Is Recorded & Logged
+
+    int64_t now = esp_timer_get_time();
+    uint32_t fresh;
+
+    if(!s_ready){
+        return;
+    }
+
+    taskENTER_CRITICAL(&s_lock);
+    fresh = bits & ~s_ready_seen;
+    s_ready_seen |= bits;
+    for(uint8_t i = 0; i < UTIL_BOOT_READY_BITS; i++){
+        if(fresh & (1 << i)){
+            s_ready_us[i] = now;
+        }
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    if(fresh == 0){
+        return;
+    }
+
+    xEventGroupSetBits(s_ready, bits);
+
+    for(uint8_t i = 0; i < UTIL_BOOT_READY_BITS; i++){
+        if(fresh & (1 << i)){
+            ESP_LOGI(DEBUG_TAG_UTIL_BOOT, "Ready %-11s At %6" PRId64 " ms", s_ready_names[i], now / 1000);
+        }
+    }
+}
+
+void UTIL_BOOT_Fail(uint32_t bits)
+{
+    // Mark Readiness Bits As Failed
+    // They Are Never Set. Waiters On Them Return Instead Of Timing Out
+
+    uint32_t fresh;
+
+    if(!s_ready || bits == 0){
+        return;
+    }
+
+    taskENTER_CRITICAL(&s_lock);
+    fresh = bits & ~s_failed & ~s_ready_seen;
+    s_failed |= fresh;
+    taskEXIT_CRITICAL(&s_lock);
+
+    if(fresh == 0){
+        return;
+    }
+
+    xEventGroupSetBits(s_ready, fresh << UTIL_BOOT_FAILED_SHIFT);
+
+    for(uint8_t i = 0; i < UTIL_BOOT_READY_BITS; i++){
+        if(fresh & (1 << i)){
+            ESP_LOGE(DEBUG_TAG_UTIL_BOOT, "Failed %-10s At %6" PRId64 " ms", s_ready_names[i], esp_timer_get_time() / 1000);
+        }
+    }
+}
+
+bool UTIL_BOOT_Wait(uint32_t bits, TickType_t wait)
+{
+    // Wait Until All bits Are Set
+    // False On Timeout Or As Soon As One Of bits Failed
+
+    if(!s_ready){
+        return false;
+    }
+
+    return (s_wait(bits, wait) > 0);
+}
+
+void UTIL_BOOT_PrintReport(void)
+{
+    // Print Step Timeline & Readiness Times (ms Since Boot)
+
+    ESP_LOGI(DEBUG_TAG_UTIL_BOOT, "-----------------------------------------------");
+    ESP_LOGI(DEBUG_TAG_UTIL_BOOT, "%-12s %8s %8s %8s %4s", "STEP", "START", "END", "TOOK", "OK");
+    for(uint8_t i = 0; i < s_steps_count; i++){
+        ESP_LOGI(DEBUG_TAG_UTIL_BOOT, "%-12s %8" PRId64 " %8" PRId64 " %8" PRId64 " %4s",
+            s_steps[i].name,
+            s_steps[i].start_us / 1000,
+            s_steps[i].end_us / 1000,
+            (s_steps[i].end_us - s_steps[i].start_us) / 1000,
+            s_steps[i].ok ? "Y" : (s_steps[i].skipped ? "Skip" : "N")
+        );
+    }
+    for(uint8_t i = 0; i < UTIL_BOOT_READY_BITS; i++){
+        if(s_ready_seen & (1 << i)){
+            ESP_LOGI(DEBUG_TAG_UTIL_BOOT, "Ready %-11s At %6" PRId64 " ms", s_ready_names[i], s_ready_us[i] / 1000);
+        }else if(s_failed & (1 << i)){
+            ESP_LOGI(DEBUG_TAG_UTIL_BOOT, "Ready %-11s Failed", s_ready_names[i]);
+        }else{
+            ESP_LOGI(DEBUG_TAG_UTIL_BOOT, "Ready %-11s Pending", s_ready_names[i]);
+        }
+    }
+    ESP_LOGI(DEBUG_TAG_UTIL_BOOT, "-----------------------------------------------");
+}
+
+static int8_t s_wait(uint32_t bits, TickType_t wait)
+{
+    // Wait Until All bits Are Set Or One Of Them Failed
+    // 1 Ready, -1 Failed, 0 Timeout
+
+    uint32_t failed = bits << UTIL_BOOT_FAILED_SHIFT;
+    TickType_t deadline = xTaskGetTickCount() + wait;
+    TickType_t now;
+    EventBits_t got;
+
+    while(true){
+        got = xEventGroupGetBits(s_ready);
+        if(got & failed){
+            return -1;
+        }
+        if((got & bits) == bits){
+            return 1;
+        }
+
+        now = xTaskGetTickCount();
+        if(wait != portMAX_DELAY && (int32_t)(deadline - now) <= 0){
+            return 0;
+        }
+
+        // Any Change Of The Awaited Or Failed Bits Rechecks
+        xEventGroupWaitBits(s_ready, (bits & ~got) | failed, pdFALSE, pdFALSE, (wait == portMAX_DELAY) ? portMAX_DELAY : (deadline - now));
+    }
+}
+
+static void s_task_step(void* arg)
+{
+    // Boot Step Task
+    // Waits For Requirements, Runs The Step, Publishes What It Provides
+    // A Failed Requirement Skips The Step, Which Then Fails What It Provides
+
+    util_boot_step_t* step = (util_boot_step_t*)arg;
+
+    if(step->requires && s_wait(step->requires, portMAX_DELAY) < 0){
+        step->skipped = true;
+        step->start_us = esp_timer_get_time();
+        step->end_us = step->start_us;
+        ESP_LOGE(DEBUG_TAG_UTIL_BOOT, "Step %s Skipped. Requirement Failed", step->name);
+    }else{
+        step->start_us = esp_timer_get_time();
+        step->ok = step->run();
+        step->end_us = esp_timer_get_time();
+
+        if(!step->ok){
+            ESP_LOGE(DEBUG_TAG_UTIL_BOOT, "Step %s Failed", step->name);
+        }
+        ESP_LOGI(DEBUG_TAG_UTIL_BOOT, "Step %s Done In %" PRId64 " ms", step->name, (step->end_us - step->start_us) / 1000);
+    }
+
+    // Record The Failure, Dependents Must Not Start On A Half Initialized Component
+    if(step->ok){
+        UTIL_BOOT_Signal(step->provides);
+    }else{
+        UTIL_BOOT_Fail(step->provides);
+    }
+    xSemaphoreGive(s_done);
+
+    UTIL_TASKPLAN_StackNote();
+    vTaskDelete(NULL);
+}
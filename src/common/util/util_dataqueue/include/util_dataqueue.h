@@ -17,20 +17,35 @@ typedef enum{
     DATA_TYPE_NOTIFICATION
 }util_dataqueue_data_type_t;
 
+// Notification Id Bases
+// Targets Receive Notifications From Several Sources In One Queue So Ids Must Not Overlap
+#define UTIL_DATAQUEUE_NOTIFICATION_BASE_DRIVER_WIFI    (0x00)
+#define UTIL_DATAQUEUE_NOTIFICATION_BASE_MODULE_API     (0x20)
+#define UTIL_DATAQUEUE_NOTIFICATION_BASE_MODULE_CLOCK   (0x30)
+
+// Time & Weather Travel As Compact Binary State
+// Formatted To Text Only In The Lvgl Task (driver_lcd), Only When A Displayed Field Changes
+typedef struct{
+    uint32_t timestamp;         // Utc Epoch (s)
+    int32_t gmt_offset;         // Local = timestamp + gmt_offset
+}util_dataqueue_timedata_t;
+
+typedef struct{
+    int16_t temp_centi;         // 0.01 C
+    uint8_t humidity;           // %
+    uint16_t condition_id;      // Openweather Condition Code
+    uint32_t sunrise;           // Utc Epoch (s)
+    uint32_t sunset;            // Utc Epoch (s)
+}util_dataqueue_weatherdata_t;
+
 typedef struct{
     union{
         char ip[16];
-        struct{
-            uint32_t timestamp;
-            char time_string[16];
-            char am_pm_string[3];
-            char date_string[48];
-        }timedata;
-        struct{
-            char humidity[8];
-            char temp[8];
-        }weatherdata;
+        util_dataqueue_timedata_t timedata;
+        util_dataqueue_weatherdata_t weatherdata;
         char location[16];
+        uint16_t channel_mask;      // Wifi Channels, Bit n = Channel n
+        void* target;               // Notification Target (util_dataqueue_t*). Registration Commands
     }value;
 }util_dataqueue_data_buffer_type_t;
 
@@ -39,6 +54,7 @@ typedef struct
     uint8_t data;
     util_dataqueue_data_type_t data_type;
     util_dataqueue_data_buffer_type_t data_buff;
+    uint16_t trace_id;          // Set By UTIL_DATAQUEUE_MessageQueue (util_trace)
 }util_dataqueue_item_t;
 
 typedef struct
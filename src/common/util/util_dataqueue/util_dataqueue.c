@@ -4,6 +4,7 @@
 #include "esp_log.h"
 
 #include "util_dataqueue.h"
+#include "util_trace.h"
 
 // Extern Variables
 
@@ -22,28 +23,47 @@ void UTIL_DATAQUEUE_Create(util_dataqueue_t* dq, uint8_t len)
 bool UTIL_DATAQUEUE_MessageQueue(util_dataqueue_t* dq, util_dataqueue_item_t* i, TickType_t wait)
 {
     // Queue Item
+    // Traced : Item Inherits The Id Of The Handler Queueing It, Else Starts A New Chain
 
-    if(uxQueueSpacesAvailable(dq->handle) == 0){
-        return false;
+    bool ret = false;
+
+    i->trace_id = 0;
+    if(UTIL_TRACE_IsEnabled()){
+        i->trace_id = UTIL_TRACE_IdCurrent();
+        if(i->trace_id == 0){
+            i->trace_id = UTIL_TRACE_IdNext();
+        }
     }
 
-    return (xQueueSend(dq->handle, (void*)i, wait) == pdPASS);
+    if(uxQueueSpacesAvailable(dq->handle) > 0){
+        ret = (xQueueSend(dq->handle, (void*)i, wait) == pdPASS);
+    }
+
+    UTIL_TRACE_Record(ret ? UTIL_TRACE_EVENT_ENQUEUE : UTIL_TRACE_EVENT_DROP, i->trace_id, NULL, dq->handle, i->data_type, i->data);
+
+    return ret;
 }
 
 bool UTIL_DATAQUEUE_MessageCheck(util_dataqueue_t* dq)
 {
     // Check For Item
 
-    return (uxQueueMessagesWaiting(dq->handle) == pdPASS);
+    return (uxQueueMessagesWaiting(dq->handle) > 0);
 }
 
 bool UTIL_DATAQUEUE_MessageGet(util_dataqueue_t* dq, util_dataqueue_item_t* i, TickType_t wait)
 {
     // Get Item
 
-    if(uxQueueMessagesWaiting(dq->handle) != pdPASS){
+    if(uxQueueMessagesWaiting(dq->handle) == 0){
         return false;
     }
 
-    return (xQueueReceive(dq->handle, (void*)i, wait) == pdPASS);
+    if(xQueueReceive(dq->handle, (void*)i, wait) != pdPASS){
+        return false;
+    }
+
+    UTIL_TRACE_Record(UTIL_TRACE_EVENT_DEQUEUE, i->trace_id, NULL, dq->handle, i->data_type, i->data);
+
+    return true;
 }
\ No newline at end of file
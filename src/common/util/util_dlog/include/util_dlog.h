@@ -0,0 +1,55 @@
+// UTIL DLOG
+// OCTOBER 19, 2026
+
+#ifndef _UTIL_DLOG_
+#define _UTIL_DLOG_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+
+#include "esp_log.h"
+
+// Deferred Log
+// Producers Store The Format String Pointer & Up To UTIL_DLOG_ARGS_MAX Raw 32 Bit Args In A Ring
+// A Low Priority Task Formats & Prints Them Later, So Logging Costs A Few Stores On The Hot Path
+// Ring Is Guarded By A Spinlock (Critical Section Held Only For The Record Copy). Not Lock Free
+// Usable From Isrs. Args Must Be 32 Bit (Integers, Pointers, Chars). No Floats Or 64 Bit Values,
+// & %s Only For Strings That Outlive The Record (Literals, Static Tables)
+// Full Ring : Oldest Records Are Overwritten & Counted As Dropped
+
+#define UTIL_DLOG_RING_LEN              (128)       // Records, Internal Ram (Isr Safe)
+#define UTIL_DLOG_ARGS_MAX              (4)
+#define UTIL_DLOG_LINE_MAX              (160)
+#define UTIL_DLOG_DRAIN_PERIOD_MS       (100)
+
+// Argument Count. More Than UTIL_DLOG_ARGS_MAX Fails To Compile
+#define UTIL_DLOG_NARGS(...)            UTIL_DLOG_NARGS_(0, ##__VA_ARGS__, UTIL_DLOG_TOO_MANY_ARGS, UTIL_DLOG_TOO_MANY_ARGS, UTIL_DLOG_TOO_MANY_ARGS, 4, 3, 2, 1, 0)
+#define UTIL_DLOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, n, ...)    n
+
+#define UTIL_DLOG(level, tag, fmt, ...) do{                                                         \
+        if(LOG_LOCAL_LEVEL >= (level)){                                                             \
+            UTIL_DLOG_Write((level), (tag), (fmt), UTIL_DLOG_NARGS(__VA_ARGS__), ##__VA_ARGS__);    \
+        }                                                                                           \
+    }while(0)
+
+#define UTIL_DLOGE(tag, fmt, ...)       UTIL_DLOG(ESP_LOG_ERROR, tag, fmt, ##__VA_ARGS__)
+#define UTIL_DLOGW(tag, fmt, ...)       UTIL_DLOG(ESP_LOG_WARN, tag, fmt, ##__VA_ARGS__)
+#define UTIL_DLOGI(tag, fmt, ...)       UTIL_DLOG(ESP_LOG_INFO, tag, fmt, ##__VA_ARGS__)
+#define UTIL_DLOGD(tag, fmt, ...)       UTIL_DLOG(ESP_LOG_DEBUG, tag, fmt, ##__VA_ARGS__)
+
+typedef struct{
+    uint32_t written;           // Since Boot
+    uint32_t printed;
+    uint32_t dropped;           // Overwritten Before The Drain Task Got To Them
+}util_dlog_stats_t;
+
+bool UTIL_DLOG_Init(void);
+
+void UTIL_DLOG_Write(esp_log_level_t level, const char* tag, const char* fmt, uint8_t nargs, ...) __attribute__((format(printf, 3, 5)));
+
+void UTIL_DLOG_GetStats(util_dlog_stats_t* stats);
+void UTIL_DLOG_PrintStats(void);
+
+#endif
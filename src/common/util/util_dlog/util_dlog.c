@@ -0,0 +1,190 @@
+// UTIL DLOG
+// OCTOBER 19, 2026
+
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <inttypes.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+#include "util_dlog.h"
+#include "util_taskplan.h"
+#include "define_rtos_tasks.h"
+
+typedef struct{
+    int64_t ts_us;
+    const char* tag;
+    const char* fmt;
+    uint32_t args[UTIL_DLOG_ARGS_MAX];
+    uint8_t level;
+    uint8_t nargs;
+}util_dlog_record_t;
+
+// Extern Variables
+
+// Local Variables
+// Ring Is Static (Internal Ram) So Isr Producers Never Touch Psram Or The Heap
+static util_dlog_record_t s_ring[UTIL_DLOG_RING_LEN];
+static uint32_t s_head;
+static uint32_t s_tail;
+static uint32_t s_printed;
+static uint32_t s_dropped;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t s_task;
+
+// Local Functions
+static bool s_pop(util_dlog_record_t* r);
+static void s_print(const util_dlog_record_t* r);
+static void s_task_drain(void* arg);
+
+// External Functions
+bool UTIL_DLOG_Init(void)
+{
+    // Start The Drain Task
+    // Records Written Before This Are Kept & Printed Once It Runs
+
+    if(s_task){
+        return true;
+    }
+
+    if(!UTIL_TASKPLAN_TaskCreate(
+        s_task_drain,
+        "t-u-dlog",
+        TASK_STACK_DEPTH_DLOG,
+        NULL,
+        TASK_PRIORITY_DLOG,
+        &s_task,
+        tskNO_AFFINITY,
+        TASK_STACK_PSRAM_DLOG
+    )){
+        ESP_LOGE(DEBUG_TAG_UTIL_DLOG, "Task Create Fail");
+        return false;
+    }
+
+    ESP_LOGI(DEBUG_TAG_UTIL_DLOG, "Init. %u Records (%u B)", UTIL_DLOG_RING_LEN, (unsigned)sizeof(s_ring));
+    return true;
+}
+
+void IRAM_ATTR UTIL_DLOG_Write(esp_log_level_t level, const char* tag, const char* fmt, uint8_t nargs, ...)
+{
+    // Store One Record. No Formatting Here
+    // Task & Isr Safe. Called Through The UTIL_DLOG* Macros
+
+    util_dlog_record_t* r;
+    int64_t ts;
+    va_list ap;
+
+    if(nargs > UTIL_DLOG_ARGS_MAX){
+        nargs = UTIL_DLOG_ARGS_MAX;
+    }
+    ts = esp_timer_get_time();
+
+    portENTER_CRITICAL_SAFE(&s_lock);
+    r = &s_ring[s_head % UTIL_DLOG_RING_LEN];
+    s_head += 1;
+    r->ts_us = ts;
+    r->tag = tag;
+    r->fmt = fmt;
+    r->level = (uint8_t)level;
+    r->nargs = nargs;
+    va_start(ap, nargs);
+    for(uint8_t i = 0; i < nargs; i++){
+        r->args[i] = va_arg(ap, uint32_t);
+    }
+    va_end(ap);
+    portEXIT_CRITICAL_SAFE(&s_lock);
+}
+
+void UTIL_DLOG_GetStats(util_dlog_stats_t* stats)
+{
+    // Copy Counters
+
+    portENTER_CRITICAL(&s_lock);
+    stats->written = s_head;
+    stats->printed = s_printed;
+    stats->dropped = s_dropped;
+    portEXIT_CRITICAL(&s_lock);
+}
+
+void UTIL_DLOG_PrintStats(void)
+{
+    // Print Counters
+
+    util_dlog_stats_t stats;
+
+    UTIL_DLOG_GetStats(&stats);
+    ESP_LOGI(DEBUG_TAG_UTIL_DLOG, "Written %" PRIu32 ", Printed %" PRIu32 ", Dropped %" PRIu32,
+        stats.written, stats.printed, stats.dropped);
+}
+
+static bool s_pop(util_dlog_record_t* r)
+{
+    // Copy The Oldest Record Out Of The Ring
+    // Producer Lapped The Drain : Skip To The Oldest Record Still Held & Count The Rest As Dropped
+
+    bool found = false;
+
+    portENTER_CRITICAL(&s_lock);
+    if((s_head - s_tail) > UTIL_DLOG_RING_LEN){
+        s_dropped += (s_head - s_tail) - UTIL_DLOG_RING_LEN;
+        s_tail = s_head - UTIL_DLOG_RING_LEN;
+    }
+    if(s_tail != s_head){
+        *r = s_ring[s_tail % UTIL_DLOG_RING_LEN];
+        s_tail += 1;
+        found = true;
+    }
+    portEXIT_CRITICAL(&s_lock);
+
+    return found;
+}
+
+static void s_print(const util_dlog_record_t* r)
+{
+    // Format & Print One Record Like ESP_LOGx, Stamped With The Time It Was Written
+    // Unused Args Are Passed As 0 & Ignored By The Format
+
+    static const char letters[] = {'N', 'E', 'W', 'I', 'D', 'V'};
+    char line[UTIL_DLOG_LINE_MAX];
+    uint32_t a[UTIL_DLOG_ARGS_MAX] = {0};
+
+    memcpy(a, r->args, r->nargs * sizeof(uint32_t));
+
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    snprintf(line, sizeof(line), r->fmt, a[0], a[1], a[2], a[3]);
+    #pragma GCC diagnostic pop
+
+    esp_log_write((esp_log_level_t)r->level, r->tag, "%c (%" PRIu32 ") %s: %s\n",
+        letters[(r->level < sizeof(letters)) ? r->level : 0],
+        (uint32_t)(r->ts_us / 1000),
+        r->tag,
+        line
+    );
+}
+
+static void s_task_drain(void* arg)
+{
+    // Drain Task
+    // Lowest Priority, So Formatting & Uart Time Is Taken From Idle Time, Not From The Producers
+
+    util_dlog_record_t r;
+    uint32_t dropped_reported = 0;
+
+    while(1){
+        while(s_pop(&r)){
+            s_print(&r);
+            s_printed += 1;
+        }
+        if(s_dropped != dropped_reported){
+            ESP_LOGW(DEBUG_TAG_UTIL_DLOG, "%" PRIu32 " Records Dropped (Ring Full)", s_dropped - dropped_reported);
+            dropped_reported = s_dropped;
+        }
+        vTaskDelay(pdMS_TO_TICKS(UTIL_DLOG_DRAIN_PERIOD_MS));
+    }
+}
@@ -0,0 +1,57 @@
+// UTIL EXECUTOR
+// OCTOBER 19, 2026
+
+#ifndef _UTIL_EXECUTOR_
+#define _UTIL_EXECUTOR_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+
+#include "util_dataqueue.h"
+
+// One Cooperative Worker Task Per Core
+// Clients (Drivers / Modules) Run As Event Handlers On The Worker Of Their Core
+// Handlers Must Not Block For Long, Every Other Client On That Core Waits
+
+#define UTIL_EXECUTOR_CLIENTS_MAX           (6)     // Per Core
+#define UTIL_EXECUTOR_QUEUESET_LEN          (32)    // Per Core. Sum Of Client Data Queue Lengths + Kick Queue
+
+typedef struct{
+    // Client Configuration (Set Before Register)
+    const char* name;
+    BaseType_t core;
+    util_dataqueue_t* dq;
+    void (*on_message)(util_dataqueue_item_t* dq_i);
+    void (*on_iter)(void);
+    void (*on_timer)(void);
+
+    // Executor Internal. Kick & Timer Fields Under The Executor Lock
+    bool registered;
+    uint8_t index;
+    volatile bool kick_pending;
+    bool timer_active;
+    bool timer_periodic;
+    TickType_t timer_period;
+    TickType_t timer_deadline;
+    uint32_t count_message;
+    uint32_t count_iter;
+    uint32_t count_timer;
+}util_executor_client_t;
+
+bool UTIL_EXECUTOR_Register(util_executor_client_t* c);
+
+bool UTIL_EXECUTOR_Kick(util_executor_client_t* c);
+
+void UTIL_EXECUTOR_TimerStart(util_executor_client_t* c, uint32_t period_ms, bool periodic);
+void UTIL_EXECUTOR_TimerStop(util_executor_client_t* c);
+bool UTIL_EXECUTOR_TimerIsActive(util_executor_client_t* c);
+
+void UTIL_EXECUTOR_PrintStats(void);
+
+#endif
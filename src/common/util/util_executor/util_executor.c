@@ -0,0 +1,433 @@
+// UTIL EXECUTOR
+// OCTOBER 19, 2026
+
+#include "freertos/semphr.h"
+#include "esp_log.h"
+
+#include "util_executor.h"
+#include "util_trace.h"
+#include "define_common_data_types.h"
+#include "define_rtos_tasks.h"
+
+#define UTIL_EXECUTOR_KICK_QUEUE_LEN        (UTIL_EXECUTOR_CLIENTS_MAX + 1)
+#define UTIL_EXECUTOR_KICK_INDEX_WAKE       (0xFF)
+
+typedef struct{
+    TaskHandle_t handle;
+    QueueSetHandle_t queueset;
+    QueueHandle_t kick_queue;
+    uint16_t queueset_len_used;
+    uint8_t clients_count;
+    bool wake_pending;                      // Wake Entry Already In kick_queue. Under s_lock
+    util_executor_client_t* clients[UTIL_EXECUTOR_CLIENTS_MAX];
+}util_executor_worker_t;
+
+// Extern Variables
+
+// Local Variables
+static util_executor_worker_t s_workers[portNUM_PROCESSORS];
+static const uint32_t s_worker_stack_depth[] = {
+    TASK_STACK_DEPTH_EXECUTOR_CORE0,
+    TASK_STACK_DEPTH_EXECUTOR_CORE1
+};
+static SemaphoreHandle_t s_register_lock;
+static portMUX_TYPE s_register_lock_init = portMUX_INITIALIZER_UNLOCKED;
+// Kick / Wake Pending Flags & Client Timer Fields. Written From Any Task, Read By The Workers
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Local Functions
+static bool s_register(util_executor_client_t* c);
+static bool s_worker_create(BaseType_t core);
+static void s_worker_wake(util_executor_worker_t* w);
+static util_executor_client_t* s_client_find(util_executor_worker_t* w, QueueSetMemberHandle_t member);
+static void s_client_iter(util_executor_client_t* c);
+static TickType_t s_timer_wait_ticks(util_executor_worker_t* w);
+static void s_timer_service(util_executor_worker_t* w);
+static void s_task_worker(void *pvParameters);
+
+// External Functions
+bool UTIL_EXECUTOR_Register(util_executor_client_t* c)
+{
+    // Register Client With The Worker Of Its Core
+    // Call From Init Context Only. Client Data Queue Must Be Empty
+    // Boot Steps (util_boot) Register Concurrently, So Registration Is Serialised
+
+    SemaphoreHandle_t lock;
+    bool ret;
+
+    if(!s_register_lock){
+        lock = xSemaphoreCreateMutex();
+        taskENTER_CRITICAL(&s_register_lock_init);
+        if(!s_register_lock){
+            s_register_lock = lock;
+            lock = NULL;
+        }
+        taskEXIT_CRITICAL(&s_register_lock_init);
+        if(lock){
+            vSemaphoreDelete(lock);
+        }
+    }
+
+    xSemaphoreTake(s_register_lock, portMAX_DELAY);
+    ret = s_register(c);
+    xSemaphoreGive(s_register_lock);
+
+    return ret;
+}
+
+bool UTIL_EXECUTOR_Kick(util_executor_client_t* c)
+{
+    // Request One Iteration Of The Client State Machine
+    // Safe To Call From Any Task (Not From ISR). Duplicate Kicks Are Merged
+
+    bool pending;
+
+    if(!c->registered){
+        return false;
+    }
+
+    // Test & Set, So Only One Of Several Concurrent Producers Enqueues
+    taskENTER_CRITICAL(&s_lock);
+    pending = c->kick_pending;
+    c->kick_pending = true;
+    taskEXIT_CRITICAL(&s_lock);
+
+    if(pending){
+        return true;
+    }
+
+    if(xQueueSend(s_workers[c->core].kick_queue, &c->index, 0) != pdPASS){
+        taskENTER_CRITICAL(&s_lock);
+        c->kick_pending = false;
+        taskEXIT_CRITICAL(&s_lock);
+        return false;
+    }
+
+    return true;
+}
+
+void UTIL_EXECUTOR_TimerStart(util_executor_client_t* c, uint32_t period_ms, bool periodic)
+{
+    // Start (Or Restart) The Client Timer
+    // on_timer Runs On The Client Worker When The Timer Expires
+
+    TickType_t period = pdMS_TO_TICKS(period_ms);
+
+    if(period == 0){
+        period = 1;
+    }
+
+    taskENTER_CRITICAL(&s_lock);
+    c->timer_period = period;
+    c->timer_periodic = periodic;
+    c->timer_deadline = xTaskGetTickCount() + period;
+    c->timer_active = true;
+    taskEXIT_CRITICAL(&s_lock);
+
+    // Worker May Be Blocked With A Longer Timeout
+    if(c->registered && xTaskGetCurrentTaskHandle() != s_workers[c->core].handle){
+        s_worker_wake(&s_workers[c->core]);
+    }
+}
+
+void UTIL_EXECUTOR_TimerStop(util_executor_client_t* c)
+{
+    // Stop The Client Timer
+
+    taskENTER_CRITICAL(&s_lock);
+    c->timer_active = false;
+    taskEXIT_CRITICAL(&s_lock);
+}
+
+bool UTIL_EXECUTOR_TimerIsActive(util_executor_client_t* c)
+{
+    // Return Client Timer State
+
+    return c->timer_active;
+}
+
+void UTIL_EXECUTOR_PrintStats(void)
+{
+    // Print Worker Stack Usage & Client Counters
+
+    util_executor_worker_t* w;
+    util_executor_client_t* c;
+
+    for(uint8_t core = 0; core < portNUM_PROCESSORS; core++){
+        w = &s_workers[core];
+        if(!w->handle){
+            continue;
+        }
+
+        ESP_LOGI(DEBUG_TAG_UTIL_EXECUTOR, "Core %u. Stack %" PRIu32 " B, Free Min %u B, Clients %u",
+            core,
+            s_worker_stack_depth[core],
+            uxTaskGetStackHighWaterMark(w->handle),
+            w->clients_count
+        );
+        for(uint8_t i = 0; i < w->clients_count; i++){
+            c = w->clients[i];
+            ESP_LOGI(DEBUG_TAG_UTIL_EXECUTOR, "   %-8s Msg %" PRIu32 " Iter %" PRIu32 " Timer %" PRIu32,
+                c->name,
+                c->count_message,
+                c->count_iter,
+                c->count_timer
+            );
+        }
+    }
+}
+
+static bool s_register(util_executor_client_t* c)
+{
+    // Register Client. Caller Holds s_register_lock
+
+    util_executor_worker_t* w;
+    UBaseType_t dq_len;
+
+    if(c->core < 0 || c->core >= portNUM_PROCESSORS){
+        c->core = 0;
+    }
+    w = &s_workers[c->core];
+
+    // Workers Are Created On First Use So Unused Cores Cost No Stack
+    if(!w->handle && !s_worker_create(c->core)){
+        return false;
+    }
+
+    if(w->clients_count >= UTIL_EXECUTOR_CLIENTS_MAX){
+        ESP_LOGE(DEBUG_TAG_UTIL_EXECUTOR, "Core %d Client Slots Full. %s Rejected", c->core, c->name);
+        return false;
+    }
+
+    // Every Slot Of The Client Data Queue Needs A Slot In The Queue Set
+    if(c->dq){
+        dq_len = uxQueueSpacesAvailable(c->dq->handle);
+        if(uxQueueMessagesWaiting(c->dq->handle) != 0 || (w->queueset_len_used + dq_len) > UTIL_EXECUTOR_QUEUESET_LEN){
+            ESP_LOGE(DEBUG_TAG_UTIL_EXECUTOR, "Core %d Queue Set Full. %s Rejected", c->core, c->name);
+            return false;
+        }
+        if(xQueueAddToSet(c->dq->handle, w->queueset) != pdPASS){
+            return false;
+        }
+        w->queueset_len_used += dq_len;
+    }
+
+    c->index = w->clients_count;
+    c->kick_pending = false;
+    c->timer_active = false;
+    c->count_message = 0;
+    c->count_iter = 0;
+    c->count_timer = 0;
+    w->clients[w->clients_count] = c;
+    w->clients_count += 1;
+    c->registered = true;
+
+    ESP_LOGI(DEBUG_TAG_UTIL_EXECUTOR, "Core %d. Client %s Registered", c->core, c->name);
+
+    return true;
+}
+
+static bool s_worker_create(BaseType_t core)
+{
+    // Create Worker Task & Its Queue Set For Core
+
+    util_executor_worker_t* w = &s_workers[core];
+    char name[16];
+
+    w->queueset = xQueueCreateSet(UTIL_EXECUTOR_QUEUESET_LEN);
+    assert(w->queueset);
+    w->kick_queue = xQueueCreate(UTIL_EXECUTOR_KICK_QUEUE_LEN, sizeof(uint8_t));
+    assert(w->kick_queue);
+    xQueueAddToSet(w->kick_queue, w->queueset);
+    w->queueset_len_used = UTIL_EXECUTOR_KICK_QUEUE_LEN;
+    w->clients_count = 0;
+    w->wake_pending = false;
+
+    sprintf(name, "t-u-exec%d", (int)core);
+    if(xTaskCreatePinnedToCore(
+        s_task_worker,
+        name,
+        s_worker_stack_depth[core],
+        (void*)w,
+        TASK_PRIORITY_EXECUTOR,
+        &w->handle,
+        core
+    ) != pdPASS){
+        ESP_LOGE(DEBUG_TAG_UTIL_EXECUTOR, "Core %d Worker Create Fail", core);
+        return false;
+    }
+
+    ESP_LOGI(DEBUG_TAG_UTIL_EXECUTOR, "Core %d Worker Created", core);
+
+    return true;
+}
+
+static void s_worker_wake(util_executor_worker_t* w)
+{
+    // Wake Worker Without Running Any Client
+    // One Wake Entry At Most, So Wakes Never Take The Queue Slots Of Client Kicks
+
+    uint8_t index = UTIL_EXECUTOR_KICK_INDEX_WAKE;
+    bool pending;
+
+    taskENTER_CRITICAL(&s_lock);
+    pending = w->wake_pending;
+    w->wake_pending = true;
+    taskEXIT_CRITICAL(&s_lock);
+
+    if(pending){
+        return;
+    }
+
+    if(xQueueSend(w->kick_queue, &index, 0) != pdPASS){
+        taskENTER_CRITICAL(&s_lock);
+        w->wake_pending = false;
+        taskEXIT_CRITICAL(&s_lock);
+    }
+}
+
+static util_executor_client_t* s_client_find(util_executor_worker_t* w, QueueSetMemberHandle_t member)
+{
+    // Find Client Owning Data Queue
+
+    for(uint8_t i = 0; i < w->clients_count; i++){
+        if(w->clients[i]->dq && w->clients[i]->dq->handle == member){
+            return w->clients[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void s_client_iter(util_executor_client_t* c)
+{
+    // Run One Client State Machine Iteration
+
+    if(c->on_iter){
+        c->count_iter += 1;
+        c->on_iter();
+    }
+}
+
+static TickType_t s_timer_wait_ticks(util_executor_worker_t* w)
+{
+    // Ticks Until The Nearest Client Timer Deadline
+
+    TickType_t now = xTaskGetTickCount();
+    TickType_t wait = portMAX_DELAY;
+    int32_t remaining;
+
+    taskENTER_CRITICAL(&s_lock);
+    for(uint8_t i = 0; i < w->clients_count; i++){
+        if(!w->clients[i]->timer_active){
+            continue;
+        }
+
+        remaining = (int32_t)(w->clients[i]->timer_deadline - now);
+        if(remaining <= 0){
+            wait = 0;
+            break;
+        }
+        if((TickType_t)remaining < wait){
+            wait = (TickType_t)remaining;
+        }
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    return wait;
+}
+
+static void s_timer_service(util_executor_worker_t* w)
+{
+    // Fire Expired Client Timers
+
+    util_executor_client_t* c;
+    TickType_t now = xTaskGetTickCount();
+    bool fire;
+
+    for(uint8_t i = 0; i < w->clients_count; i++){
+        c = w->clients[i];
+
+        // Handlers Run Outside The Lock. A Restart From on_timer Is Kept
+        taskENTER_CRITICAL(&s_lock);
+        fire = c->timer_active && (int32_t)(c->timer_deadline - now) <= 0;
+        if(fire){
+            if(c->timer_periodic){
+                c->timer_deadline += c->timer_period;
+                // Do Not Fire A Burst After A Long Handler
+                if((int32_t)(c->timer_deadline - now) <= 0){
+                    c->timer_deadline = now + c->timer_period;
+                }
+            }else{
+                c->timer_active = false;
+            }
+        }
+        taskEXIT_CRITICAL(&s_lock);
+
+        if(!fire){
+            continue;
+        }
+
+        c->count_timer += 1;
+        if(c->on_timer){
+            c->on_timer();
+        }
+        s_client_iter(c);
+    }
+}
+
+static void s_task_worker(void *pvParameters)
+{
+    // Worker Task
+    // Dispatches Messages, Kicks & Timers To The Clients Of This Core
+
+    util_executor_worker_t* w = (util_executor_worker_t*)pvParameters;
+    QueueSetMemberHandle_t member;
+    util_executor_client_t* c;
+    util_dataqueue_item_t dq_i;
+    uint8_t index;
+
+    ESP_LOGI(DEBUG_TAG_UTIL_EXECUTOR, "Starting worker on core %d", xPortGetCoreID());
+
+    while(true){
+        member = xQueueSelectFromSet(w->queueset, s_timer_wait_ticks(w));
+
+        if(member == w->kick_queue)
+        {
+            if(xQueueReceive(w->kick_queue, &index, 0) == pdPASS)
+            {
+                // Cleared Before Running, So A Kick During The Iteration Queues Another
+                taskENTER_CRITICAL(&s_lock);
+                if(index == UTIL_EXECUTOR_KICK_INDEX_WAKE){
+                    w->wake_pending = false;
+                }else if(index < w->clients_count){
+                    w->clients[index]->kick_pending = false;
+                }
+                taskEXIT_CRITICAL(&s_lock);
+
+                if(index < w->clients_count){
+                    s_client_iter(w->clients[index]);
+                }
+            }
+        }
+        else if(member != NULL)
+        {
+            // Exactly One Item Must Be Read Per Select To Keep The Set In Sync
+            c = s_client_find(w, member);
+            if(c && UTIL_DATAQUEUE_MessageGet(c->dq, &dq_i, 0))
+            {
+                c->count_message += 1;
+                UTIL_TRACE_Begin(dq_i.trace_id, c->name, dq_i.data_type, dq_i.data);
+                if(c->on_message){
+                    c->on_message(&dq_i);
+                }
+                s_client_iter(c);
+                UTIL_TRACE_End(dq_i.trace_id, c->name);
+            }
+        }
+
+        s_timer_service(w);
+    }
+
+    vTaskDelete(NULL);
+}
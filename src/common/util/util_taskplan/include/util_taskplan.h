@@ -0,0 +1,46 @@
+// UTIL TASKPLAN
+// OCTOBER 19, 2026
+
+#ifndef _UTIL_TASKPLAN_
+#define _UTIL_TASKPLAN_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// Per Core Load Needs (menuconfig -> Component Config -> FreeRTOS -> Kernel)
+// 1. CONFIG_FREERTOS_USE_TRACE_FACILITY
+// 2. CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+
+#define UTIL_TASKPLAN_TASKS_MAX         (32)
+
+// Stack Budget
+// Samples Every Task High Water Mark Periodically. One Shot Tasks Report Their Own Before Deleting (UTIL_TASKPLAN_StackNote)
+// Recommended Depth = Used + Margin (Percent, At Least MARGIN_MIN For Isr Nesting & Log Calls), Rounded Up
+// Report Lines Between The Markers Are Ready To Paste Into define_rtos_tasks.h (scripts/stack_budget.py)
+#define UTIL_TASKPLAN_STACK_SAMPLE_PERIOD_MS    (1000)
+#define UTIL_TASKPLAN_STACK_MARGIN_PERCENT      (25)
+#define UTIL_TASKPLAN_STACK_MARGIN_MIN          (768)
+#define UTIL_TASKPLAN_STACK_ROUND               (256)
+#define UTIL_TASKPLAN_STACK_MARK_BEGIN          "UTIL_TASKPLAN_STACK_BEGIN"
+#define UTIL_TASKPLAN_STACK_MARK_END            "UTIL_TASKPLAN_STACK_END"
+
+typedef struct{
+    uint8_t load_percent[portNUM_PROCESSORS];
+    uint32_t window_us;
+}util_taskplan_core_load_t;
+
+bool UTIL_TASKPLAN_GetCoreLoad(util_taskplan_core_load_t* load);
+void UTIL_TASKPLAN_PrintCoreLoad(void);
+
+bool UTIL_TASKPLAN_TaskCreate(TaskFunction_t fn, const char* name, uint32_t stack_depth, void* arg, UBaseType_t priority, TaskHandle_t* handle, BaseType_t core, bool stack_psram);
+
+bool UTIL_TASKPLAN_StackBudgetStart(uint32_t report_period_s);
+void UTIL_TASKPLAN_StackNote(void);
+void UTIL_TASKPLAN_PrintStackBudget(void);
+
+#endif
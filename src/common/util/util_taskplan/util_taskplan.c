@@ -0,0 +1,296 @@
+// UTIL TASKPLAN
+// OCTOBER 19, 2026
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+#include "util_taskplan.h"
+#include "define_common_data_types.h"
+#include "define_rtos_tasks.h"
+
+typedef struct{
+    const char* task;               // Task Name, Or Prefix Ending In '-' For Task Families
+    const char* define;
+    uint32_t depth;
+    uint32_t used_max;              // 0 : Not Seen Yet
+}util_taskplan_stack_t;
+
+// Extern Variables
+
+// Local Variables
+static uint32_t s_prev_total;
+static uint32_t s_prev_idle[portNUM_PROCESSORS];
+
+// Stack Budget. Names Must Match The xTaskCreate Calls
+static util_taskplan_stack_t s_stacks[] = {
+    {.task = "t-u-exec0",   .define = "TASK_STACK_DEPTH_EXECUTOR_CORE0",    .depth = TASK_STACK_DEPTH_EXECUTOR_CORE0},
+    {.task = "t-u-exec1",   .define = "TASK_STACK_DEPTH_EXECUTOR_CORE1",    .depth = TASK_STACK_DEPTH_EXECUTOR_CORE1},
+    {.task = "t-m-api-",    .define = "TASK_STACK_DEPTH_API_FETCH",         .depth = TASK_STACK_DEPTH_API_FETCH},
+    {.task = "t-lvgl",      .define = "TASK_STACK_DEPTH_LVGL",              .depth = TASK_STACK_DEPTH_LVGL},
+    {.task = "t-lcd-setup", .define = "TASK_STACK_DEPTH_LCD_PANEL_SETUP",   .depth = TASK_STACK_DEPTH_LCD_PANEL_SETUP},
+    {.task = "t-u-trace",   .define = "TASK_STACK_DEPTH_TRACE_EXPORT",      .depth = TASK_STACK_DEPTH_TRACE_EXPORT},
+    {.task = "boot-",       .define = "TASK_STACK_DEPTH_BOOT_STEP",         .depth = TASK_STACK_DEPTH_BOOT_STEP},
+    {.task = "t-u-dlog",    .define = "TASK_STACK_DEPTH_DLOG",              .depth = TASK_STACK_DEPTH_DLOG},
+};
+static portMUX_TYPE s_stacks_lock = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool s_stacks_enabled;
+static esp_timer_handle_t s_stacks_timer;
+static int64_t s_stacks_report_period_us;
+static int64_t s_stacks_report_next_us;
+
+// Local Functions
+static bool s_sample(util_taskplan_core_load_t* load, bool print);
+static void s_stack_update(const char* name, uint32_t hwm);
+static void s_stack_sample(void);
+static void s_timer_stack_cb(void* arg);
+
+// External Functions
+bool UTIL_TASKPLAN_GetCoreLoad(util_taskplan_core_load_t* load)
+{
+    // Per Core Load Since The Previous Call
+
+    return s_sample(load, false);
+}
+
+void UTIL_TASKPLAN_PrintCoreLoad(void)
+{
+    // Print Per Core Load & Task Placement
+
+    util_taskplan_core_load_t load;
+
+    if(!s_sample(&load, true)){
+        ESP_LOGW(DEBUG_TAG_UTIL_TASKPLAN, "Enable FREERTOS_USE_TRACE_FACILITY & FREERTOS_GENERATE_RUN_TIME_STATS");
+        return;
+    }
+
+    for(uint8_t core = 0; core < portNUM_PROCESSORS; core++){
+        ESP_LOGI(DEBUG_TAG_UTIL_TASKPLAN, "Core %u Load %u %% (%" PRIu32 " ms Window)",
+            core,
+            load.load_percent[core],
+            load.window_us / 1000
+        );
+    }
+}
+
+bool UTIL_TASKPLAN_TaskCreate(TaskFunction_t fn, const char* name, uint32_t stack_depth, void* arg, UBaseType_t priority, TaskHandle_t* handle, BaseType_t core, bool stack_psram)
+{
+    // Create A Task, Stack In Psram When Requested & CONFIG_TASK_STACKS_IN_PSRAM Is Set
+    // Falls Back To Internal Ram If The Psram Stack Cannot Be Allocated
+    // core : tskNO_AFFINITY For No Pinning
+
+#if defined(CONFIG_TASK_STACKS_IN_PSRAM)
+    if(stack_psram){
+        if(xTaskCreatePinnedToCoreWithCaps(fn, name, stack_depth, arg, priority, handle, core, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT) == pdPASS){
+            ESP_LOGI(DEBUG_TAG_UTIL_TASKPLAN, "%s Stack %" PRIu32 " B In Psram", name, stack_depth);
+            return true;
+        }
+        ESP_LOGW(DEBUG_TAG_UTIL_TASKPLAN, "%s Psram Stack Fail. Using Internal", name);
+    }
+#else
+    (void)stack_psram;
+#endif
+
+    return (xTaskCreatePinnedToCore(fn, name, stack_depth, arg, priority, handle, core) == pdPASS);
+}
+
+bool UTIL_TASKPLAN_StackBudgetStart(uint32_t report_period_s)
+{
+    // Start Sampling Task Stacks
+    // Report Printed Every report_period_s (0 : Only On UTIL_TASKPLAN_PrintStackBudget)
+
+    esp_timer_create_args_t args = {
+        .callback = s_timer_stack_cb,
+        .name = "taskplan-stack"
+    };
+
+    if(s_stacks_timer){
+        return false;
+    }
+
+    if(esp_timer_create(&args, &s_stacks_timer) != ESP_OK){
+        return false;
+    }
+
+    s_stacks_report_period_us = (int64_t)report_period_s * 1000 * 1000;
+    s_stacks_report_next_us = esp_timer_get_time() + s_stacks_report_period_us;
+    s_stacks_enabled = true;
+
+    ESP_LOGI(DEBUG_TAG_UTIL_TASKPLAN, "Stack Budget Start. Report Every %" PRIu32 " s", report_period_s);
+
+    return (esp_timer_start_periodic(s_stacks_timer, (uint64_t)UTIL_TASKPLAN_STACK_SAMPLE_PERIOD_MS * 1000) == ESP_OK);
+}
+
+void UTIL_TASKPLAN_StackNote(void)
+{
+    // Record The Calling Task High Water Mark
+    // One Shot Tasks Call This Right Before vTaskDelete(NULL). No Op Unless The Budget Runs
+
+    if(!s_stacks_enabled){
+        return;
+    }
+
+    s_stack_update(pcTaskGetName(NULL), uxTaskGetStackHighWaterMark(NULL));
+}
+
+void UTIL_TASKPLAN_PrintStackBudget(void)
+{
+    // Print Measured Stack Use & Recommended Depths As define_rtos_tasks.h Lines
+
+    util_taskplan_stack_t st;
+    uint32_t rec;
+    int32_t saved = 0;
+
+    s_stack_sample();
+
+    ESP_LOGI(DEBUG_TAG_UTIL_TASKPLAN, "Stack Budget. Margin %u %% (Min %u B)", UTIL_TASKPLAN_STACK_MARGIN_PERCENT, UTIL_TASKPLAN_STACK_MARGIN_MIN);
+
+    printf("%s\n", UTIL_TASKPLAN_STACK_MARK_BEGIN);
+    for(uint8_t i = 0; i < sizeof(s_stacks) / sizeof(s_stacks[0]); i++){
+        taskENTER_CRITICAL(&s_stacks_lock);
+        st = s_stacks[i];
+        taskEXIT_CRITICAL(&s_stacks_lock);
+
+        if(st.used_max == 0){
+            printf("#define %-35s (%" PRIu32 ")\t// Not Seen, Kept\n", st.define, st.depth);
+            continue;
+        }
+        rec = st.used_max + MAX((st.used_max * UTIL_TASKPLAN_STACK_MARGIN_PERCENT) / 100, UTIL_TASKPLAN_STACK_MARGIN_MIN);
+        rec = ((rec + UTIL_TASKPLAN_STACK_ROUND - 1) / UTIL_TASKPLAN_STACK_ROUND) * UTIL_TASKPLAN_STACK_ROUND;
+        saved += (int32_t)st.depth - (int32_t)rec;
+        printf("#define %-35s (%" PRIu32 ")\t// Used %" PRIu32 " / %" PRIu32 " B\n", st.define, rec, st.used_max, st.depth);
+    }
+    printf("%s\n", UTIL_TASKPLAN_STACK_MARK_END);
+
+    // Per Define. Families (Api Fetch, Boot Steps) Save This Once Per Instance
+    ESP_LOGI(DEBUG_TAG_UTIL_TASKPLAN, "Stack Budget. %+" PRId32 " B Per Instance Set", saved);
+}
+
+static void s_stack_update(const char* name, uint32_t hwm)
+{
+    // Fold One High Water Mark Into The Budget Entry Matching The Task Name
+
+    util_taskplan_stack_t* st;
+    size_t len;
+
+    for(uint8_t i = 0; i < sizeof(s_stacks) / sizeof(s_stacks[0]); i++){
+        st = &s_stacks[i];
+        len = strlen(st->task);
+        if(st->task[len - 1] == '-' ? strncmp(name, st->task, len) : strcmp(name, st->task)){
+            continue;
+        }
+        if(hwm > st->depth){
+            return;
+        }
+        taskENTER_CRITICAL(&s_stacks_lock);
+        st->used_max = MAX(st->used_max, st->depth - hwm);
+        taskEXIT_CRITICAL(&s_stacks_lock);
+        return;
+    }
+}
+
+static void s_stack_sample(void)
+{
+    // Sample Every Running Task
+
+#if defined(CONFIG_FREERTOS_USE_TRACE_FACILITY)
+    TaskStatus_t* status;
+    UBaseType_t count;
+
+    status = (TaskStatus_t*)malloc(UTIL_TASKPLAN_TASKS_MAX * sizeof(TaskStatus_t));
+    if(!status){
+        return;
+    }
+    count = uxTaskGetSystemState(status, UTIL_TASKPLAN_TASKS_MAX, NULL);
+    for(UBaseType_t i = 0; i < count; i++){
+        s_stack_update(status[i].pcTaskName, status[i].usStackHighWaterMark);
+    }
+    free(status);
+#endif
+}
+
+static void s_timer_stack_cb(void* arg)
+{
+    // Periodic Stack Sample
+    // esp_timer Task Context
+
+    s_stack_sample();
+
+    if(s_stacks_report_period_us && esp_timer_get_time() >= s_stacks_report_next_us){
+        s_stacks_report_next_us += s_stacks_report_period_us;
+        UTIL_TASKPLAN_PrintStackBudget();
+    }
+}
+
+static bool s_sample(util_taskplan_core_load_t* load, bool print)
+{
+    // Sample Task Run Time Counters
+    // Core Load = 100 - Share Of The Window Spent In That Core Idle Task
+
+#if defined(CONFIG_FREERTOS_USE_TRACE_FACILITY) && defined(CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS)
+    TaskStatus_t* status;
+    UBaseType_t count;
+    uint32_t total;
+    uint32_t idle;
+    uint32_t window;
+    BaseType_t core_id;
+
+    status = (TaskStatus_t*)malloc(UTIL_TASKPLAN_TASKS_MAX * sizeof(TaskStatus_t));
+    if(!status){
+        return false;
+    }
+    count = uxTaskGetSystemState(status, UTIL_TASKPLAN_TASKS_MAX, &total);
+    if(count == 0 || total == 0){
+        free(status);
+        return false;
+    }
+
+    window = total - s_prev_total;
+    load->window_us = window;
+
+    for(uint8_t core = 0; core < portNUM_PROCESSORS; core++){
+        idle = 0;
+        for(UBaseType_t i = 0; i < count; i++){
+            if(status[i].xHandle == xTaskGetIdleTaskHandleForCore(core)){
+                idle = status[i].ulRunTimeCounter;
+                break;
+            }
+        }
+
+        load->load_percent[core] = 0;
+        if(window > 0 && (idle - s_prev_idle[core]) <= window){
+            load->load_percent[core] = 100 - (uint8_t)(((uint64_t)(idle - s_prev_idle[core]) * 100) / window);
+        }
+        s_prev_idle[core] = idle;
+    }
+    s_prev_total = total;
+
+    if(print){
+        ESP_LOGI(DEBUG_TAG_UTIL_TASKPLAN, "-----------------------------------------------");
+        ESP_LOGI(DEBUG_TAG_UTIL_TASKPLAN, "%-16s %4s %4s %6s", "TASK", "CORE", "PRIO", "CPU %");
+        for(UBaseType_t i = 0; i < count; i++){
+            core_id = xTaskGetCoreID(status[i].xHandle);
+            ESP_LOGI(DEBUG_TAG_UTIL_TASKPLAN, "%-16s %4s %4u %6u",
+                status[i].pcTaskName,
+                (core_id == tskNO_AFFINITY) ? "-" : ((core_id == 0) ? "0" : "1"),
+                status[i].uxCurrentPriority,
+                (unsigned)(((uint64_t)status[i].ulRunTimeCounter * 100) / total)
+            );
+        }
+        ESP_LOGI(DEBUG_TAG_UTIL_TASKPLAN, "-----------------------------------------------");
+    }
+
+    free(status);
+    return true;
+#else
+    (void)load;
+    (void)print;
+    return false;
+#endif
+}
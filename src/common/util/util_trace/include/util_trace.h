@@ -0,0 +1,62 @@
+// UTIL TRACE
+// OCTOBER 19, 2026
+
+#ifndef _UTIL_TRACE_
+#define _UTIL_TRACE_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// Message Trace
+// Every Data Queue Item Carries A Trace Id. An Item Queued While A Handler Runs Inherits The Id
+// Of The Message Being Handled, So One Id Follows An Update From Its Source To The Frame Showing It
+// (e.g. Wifi Event -> module_wifi -> main -> driver_lcd -> Flush)
+// Events Go To A Psram Ring. Export Prints Chrome Trace Json (chrome://tracing, ui.perfetto.dev) Over Uart
+// Recording Is Off Until UTIL_TRACE_Init
+
+#define UTIL_TRACE_RING_LEN             (4096)      // Events (32 B Each)
+#define UTIL_TRACE_TASKS_MAX            (24)
+#define UTIL_TRACE_TASKS_RESERVED       (8)         // Of TASKS_MAX, Kept For Tasks First Seen After Init (Boot Steps, Workers)
+#define UTIL_TRACE_TASKS_HEADROOM       (4)         // Run Time Snapshot Array Beyond The Current Task Count
+#define UTIL_TRACE_EXPORT_MARK_BEGIN    ("UTIL_TRACE_JSON_BEGIN")
+#define UTIL_TRACE_EXPORT_MARK_END      ("UTIL_TRACE_JSON_END")
+
+typedef enum{
+    UTIL_TRACE_EVENT_ENQUEUE = 0,
+    UTIL_TRACE_EVENT_DROP,              // Enqueue Failed (Queue Full)
+    UTIL_TRACE_EVENT_DEQUEUE,
+    UTIL_TRACE_EVENT_BEGIN,             // Handler Start
+    UTIL_TRACE_EVENT_END,               // Handler End
+    UTIL_TRACE_EVENT_FLUSH,             // Frame Carrying The Update Flushed To The Panel
+}util_trace_event_type_t;
+
+typedef struct{
+    int64_t ts_us;
+    const char* name;                   // Static String Or NULL
+    const void* queue;                  // Queue Handle (Enqueue / Drop / Dequeue)
+    TaskHandle_t task;
+    uint16_t id;
+    uint8_t type;
+    uint8_t core;
+    uint8_t data_type;
+    uint8_t data;
+}util_trace_event_t;
+
+bool UTIL_TRACE_Init(uint32_t export_after_s);
+bool UTIL_TRACE_IsEnabled(void);
+
+uint16_t UTIL_TRACE_IdNext(void);
+uint16_t UTIL_TRACE_IdCurrent(void);
+
+void UTIL_TRACE_Record(util_trace_event_type_t type, uint16_t id, const char* name, const void* queue, uint8_t data_type, uint8_t data);
+void UTIL_TRACE_Begin(uint16_t id, const char* name, uint8_t data_type, uint8_t data);
+void UTIL_TRACE_End(uint16_t id, const char* name);
+
+void UTIL_TRACE_Export(void);
+
+#endif
@@ -0,0 +1,378 @@
+// UTIL TRACE
+// OCTOBER 19, 2026
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+#include "util_trace.h"
+#include "define_common_data_types.h"
+#include "define_rtos_tasks.h"
+
+// Export Yields Every This Many Lines. Console Output Busy Waits On The Uart
+#define UTIL_TRACE_EXPORT_YIELD_LINES   (32)
+
+typedef struct{
+    TaskHandle_t handle;
+    char name[configMAX_TASK_NAME_LEN];
+    uint32_t runtime_start;
+}util_trace_task_t;
+
+// Extern Variables
+
+// Local Variables
+static util_trace_event_t* s_ring;
+static uint32_t s_head;
+static volatile bool s_enabled;
+static uint16_t s_id_last;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static util_trace_task_t s_tasks[UTIL_TRACE_TASKS_MAX];
+static uint8_t s_tasks_count;
+static uint16_t s_tasks_dropped;                // Tasks Seen With The Table Full. Exported As tid 0
+static uint32_t s_runtime_total_start;
+static uint32_t s_export_after_s;
+
+// Per Task. Id Of The Message Whose Handler Is Running
+static __thread uint16_t s_id_current;
+static __thread bool s_task_known;
+
+// Local Functions
+static void s_task_add(TaskHandle_t handle);
+static uint8_t s_task_index(TaskHandle_t handle);
+static void s_runtime_snapshot(bool start, int64_t ts);
+static void s_event_print(const util_trace_event_t* e);
+static void s_task_export(void* arg);
+
+// External Functions
+bool UTIL_TRACE_Init(uint32_t export_after_s)
+{
+    // Allocate The Event Ring & Start Recording
+    // export_after_s > 0 : Export Once From A Low Priority Task After That Long
+
+    s_ring = (util_trace_event_t*)heap_caps_calloc(UTIL_TRACE_RING_LEN, sizeof(util_trace_event_t), MALLOC_CAP_SPIRAM);
+    if(!s_ring){
+        ESP_LOGE(DEBUG_TAG_UTIL_TRACE, "Ring Alloc Fail (%u B Psram)", (unsigned)(UTIL_TRACE_RING_LEN * sizeof(util_trace_event_t)));
+        return false;
+    }
+
+    s_head = 0;
+    s_id_last = 0;
+    s_tasks_count = 0;
+    s_tasks_dropped = 0;
+    s_runtime_snapshot(true, 0);
+    s_enabled = true;
+
+    ESP_LOGI(DEBUG_TAG_UTIL_TRACE, "Init. %u Events", UTIL_TRACE_RING_LEN);
+
+    if(export_after_s){
+        s_export_after_s = export_after_s;
+        xTaskCreate(
+            s_task_export,
+            "t-u-trace",
+            TASK_STACK_DEPTH_TRACE_EXPORT,
+            NULL,
+            TASK_PRIORITY_TRACE_EXPORT,
+            NULL
+        );
+    }
+
+    return true;
+}
+
+bool UTIL_TRACE_IsEnabled(void)
+{
+    // Return Recording State
+
+    return s_enabled;
+}
+
+uint16_t UTIL_TRACE_IdNext(void)
+{
+    // New Trace Id. 0 Means Untraced
+
+    uint16_t id;
+
+    taskENTER_CRITICAL(&s_lock);
+    s_id_last += 1;
+    if(s_id_last == 0){
+        s_id_last = 1;
+    }
+    id = s_id_last;
+    taskEXIT_CRITICAL(&s_lock);
+
+    return id;
+}
+
+uint16_t UTIL_TRACE_IdCurrent(void)
+{
+    // Id Of The Message Handled By The Calling Task. 0 Outside A Handler
+
+    return s_id_current;
+}
+
+void UTIL_TRACE_Record(util_trace_event_type_t type, uint16_t id, const char* name, const void* queue, uint8_t data_type, uint8_t data)
+{
+    // Record One Event
+    // Task Context Only
+
+    util_trace_event_t* e;
+    TaskHandle_t task;
+    int64_t ts;
+
+    if(!s_enabled){
+        return;
+    }
+
+    ts = esp_timer_get_time();
+    task = xTaskGetCurrentTaskHandle();
+    if(!s_task_known){
+        s_task_add(task);
+        s_task_known = true;
+    }
+
+    taskENTER_CRITICAL(&s_lock);
+    e = &s_ring[s_head % UTIL_TRACE_RING_LEN];
+    s_head += 1;
+    e->ts_us = ts;
+    e->name = name;
+    e->queue = queue;
+    e->task = task;
+    e->id = id;
+    e->type = type;
+    e->core = (uint8_t)xPortGetCoreID();
+    e->data_type = data_type;
+    e->data = data;
+    taskEXIT_CRITICAL(&s_lock);
+}
+
+void UTIL_TRACE_Begin(uint16_t id, const char* name, uint8_t data_type, uint8_t data)
+{
+    // Handler Start. Items Queued Until UTIL_TRACE_End Inherit id
+
+    UTIL_TRACE_Record(UTIL_TRACE_EVENT_BEGIN, id, name, NULL, data_type, data);
+    s_id_current = id;
+}
+
+void UTIL_TRACE_End(uint16_t id, const char* name)
+{
+    // Handler End
+
+    UTIL_TRACE_Record(UTIL_TRACE_EVENT_END, id, name, NULL, 0, 0);
+    s_id_current = 0;
+}
+
+void UTIL_TRACE_Export(void)
+{
+    // Print The Ring As Chrome Trace Events. One Json Object Per Line Between The Markers
+    // scripts/trace_extract.py Wraps Them Into A Trace File. Recording Pauses Meanwhile
+
+    util_trace_event_t e;
+    uint32_t count;
+    uint32_t first;
+    int64_t ts_last = 0;
+
+    if(!s_ring){
+        return;
+    }
+
+    s_enabled = false;
+
+    taskENTER_CRITICAL(&s_lock);
+    count = (s_head < UTIL_TRACE_RING_LEN) ? s_head : UTIL_TRACE_RING_LEN;
+    first = s_head - count;
+    taskEXIT_CRITICAL(&s_lock);
+
+    ESP_LOGI(DEBUG_TAG_UTIL_TRACE, "Export %" PRIu32 " Events (%" PRIu32 " Overwritten)", count, first);
+    if(s_tasks_dropped){
+        ESP_LOGW(DEBUG_TAG_UTIL_TRACE, "Task Table Full. %u Tasks Exported As tid 0", s_tasks_dropped);
+    }
+
+    printf("%s\n", UTIL_TRACE_EXPORT_MARK_BEGIN);
+    for(uint8_t i = 0; i < s_tasks_count; i++){
+        printf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"%s\"}}\n", i + 1, s_tasks[i].name);
+    }
+    for(uint32_t i = 0; i < count; i++){
+        e = s_ring[(first + i) % UTIL_TRACE_RING_LEN];
+        s_event_print(&e);
+        ts_last = e.ts_us;
+        if((i % UTIL_TRACE_EXPORT_YIELD_LINES) == 0){
+            vTaskDelay(1);
+        }
+    }
+    s_runtime_snapshot(false, ts_last);
+    printf("%s\n", UTIL_TRACE_EXPORT_MARK_END);
+
+    s_enabled = true;
+}
+
+static void s_task_add(TaskHandle_t handle)
+{
+    // Remember Task Name. Tasks May Be Deleted Before Export
+    // Called Once Per Task, So A Full Table Is Logged Once Per Dropped Task
+
+    bool dropped = false;
+
+    taskENTER_CRITICAL(&s_lock);
+    if(s_task_index(handle) == 0){
+        if(s_tasks_count < UTIL_TRACE_TASKS_MAX){
+            s_tasks[s_tasks_count].handle = handle;
+            strncpy(s_tasks[s_tasks_count].name, pcTaskGetName(handle), configMAX_TASK_NAME_LEN - 1);
+            s_tasks_count += 1;
+        }else{
+            s_tasks_dropped += 1;
+            dropped = true;
+        }
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    if(dropped){
+        ESP_LOGW(DEBUG_TAG_UTIL_TRACE, "Task Table Full (%u). %s Traced As tid 0", UTIL_TRACE_TASKS_MAX, pcTaskGetName(handle));
+    }
+}
+
+static uint8_t s_task_index(TaskHandle_t handle)
+{
+    // Trace Thread Id Of Task. 0 When Unknown
+
+    for(uint8_t i = 0; i < s_tasks_count; i++){
+        if(s_tasks[i].handle == handle){
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
+
+static void s_runtime_snapshot(bool start, int64_t ts)
+{
+    // Per Task Cpu Share Over The Trace
+    // start : Remember Run Time Counters. Otherwise Print A Counter Event With Each Traced Task Share
+
+#if defined(CONFIG_FREERTOS_USE_TRACE_FACILITY) && defined(CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS)
+    TaskStatus_t* status;
+    UBaseType_t len;
+    UBaseType_t count;
+    uint32_t total;
+    uint32_t window;
+    bool first = true;
+
+    // uxTaskGetSystemState Returns Nothing If The Array Is Short, So Size It From The Live Task Count
+    len = uxTaskGetNumberOfTasks() + UTIL_TRACE_TASKS_HEADROOM;
+    status = (TaskStatus_t*)malloc(len * sizeof(TaskStatus_t));
+    if(!status){
+        return;
+    }
+    count = uxTaskGetSystemState(status, len, &total);
+
+    if(start){
+        // Reserved Slots Stay Free For Tasks Created Later
+        s_runtime_total_start = total;
+        for(UBaseType_t i = 0; i < count && s_tasks_count < (UTIL_TRACE_TASKS_MAX - UTIL_TRACE_TASKS_RESERVED); i++){
+            s_tasks[s_tasks_count].handle = status[i].xHandle;
+            strncpy(s_tasks[s_tasks_count].name, status[i].pcTaskName, configMAX_TASK_NAME_LEN - 1);
+            s_tasks[s_tasks_count].runtime_start = status[i].ulRunTimeCounter;
+            s_tasks_count += 1;
+        }
+        if(count > s_tasks_count){
+            ESP_LOGW(DEBUG_TAG_UTIL_TRACE, "%u Tasks At Init, %u Snapshot. Rest Are Added When They Record", (unsigned)count, s_tasks_count);
+        }
+    }else{
+        window = (total - s_runtime_total_start) * portNUM_PROCESSORS;
+        printf("{\"name\":\"cpu %%\",\"ph\":\"C\",\"ts\":%" PRId64 ",\"pid\":0,\"args\":{", ts);
+        for(UBaseType_t i = 0; i < count && window > 0; i++){
+            uint8_t t = s_task_index(status[i].xHandle);
+            if(t == 0){
+                continue;
+            }
+            printf("%s\"%s\":%u",
+                first ? "" : ",",
+                s_tasks[t - 1].name,
+                (unsigned)(((uint64_t)(status[i].ulRunTimeCounter - s_tasks[t - 1].runtime_start) * 100) / window)
+            );
+            first = false;
+        }
+        printf("}}\n");
+    }
+
+    free(status);
+#else
+    (void)start;
+    (void)ts;
+    (void)s_runtime_total_start;
+#endif
+}
+
+static void s_event_print(const util_trace_event_t* e)
+{
+    // Print One Event As Chrome Trace Json
+    // Handler Slices Sharing An Id Are Chained With Flow Arrows (bind_id)
+
+    static const char* s_queue_names[] = {"enqueue", "drop", "dequeue"};
+    uint8_t tid = s_task_index(e->task);
+
+    switch(e->type)
+    {
+        case UTIL_TRACE_EVENT_ENQUEUE:
+        case UTIL_TRACE_EVENT_DROP:
+        case UTIL_TRACE_EVENT_DEQUEUE:
+            printf("{\"name\":\"%s\",\"cat\":\"queue\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%" PRId64 ",\"pid\":0,\"tid\":%u,\"args\":{\"id\":%u,\"queue\":\"%p\",\"type\":%u,\"data\":%u,\"core\":%u}}\n",
+                s_queue_names[e->type],
+                e->ts_us,
+                tid,
+                e->id,
+                e->queue,
+                e->data_type,
+                e->data,
+                e->core
+            );
+            break;
+
+        case UTIL_TRACE_EVENT_BEGIN:
+            printf("{\"name\":\"%s %u:%u\",\"cat\":\"handler\",\"ph\":\"B\",\"ts\":%" PRId64 ",\"pid\":0,\"tid\":%u,\"bind_id\":\"0x%x\",\"flow_in\":true,\"flow_out\":true,\"args\":{\"id\":%u,\"core\":%u}}\n",
+                e->name ? e->name : "handler",
+                e->data_type,
+                e->data,
+                e->ts_us,
+                tid,
+                e->id,
+                e->id,
+                e->core
+            );
+            break;
+
+        case UTIL_TRACE_EVENT_END:
+            printf("{\"ph\":\"E\",\"ts\":%" PRId64 ",\"pid\":0,\"tid\":%u}\n", e->ts_us, tid);
+            break;
+
+        case UTIL_TRACE_EVENT_FLUSH:
+            printf("{\"name\":\"%s\",\"cat\":\"flush\",\"ph\":\"X\",\"dur\":1,\"ts\":%" PRId64 ",\"pid\":0,\"tid\":%u,\"bind_id\":\"0x%x\",\"flow_in\":true,\"args\":{\"id\":%u,\"core\":%u}}\n",
+                e->name ? e->name : "flush",
+                e->ts_us,
+                tid,
+                e->id,
+                e->id,
+                e->core
+            );
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void s_task_export(void* arg)
+{
+    // One Shot Export Task
+
+    vTaskDelay(pdMS_TO_TICKS(s_export_after_s * 1000));
+    UTIL_TRACE_Export();
+
+    vTaskDelete(NULL);
+}
@@ -11,20 +11,54 @@
 #include "module_lcd.h"
 #include "module_api.h"
 #include "module_wifi.h"
+#include "module_clock.h"
 #include "driver_api.h"
 #include "driver_wifi.h"
 #include "driver_lcd.h"
 #include "driver_chipinfo.h"
 #include "driver_appinfo.h"
 #include "driver_spiffs.h"
+#include "util_executor.h"
+#include "util_taskplan.h"
+#include "util_trace.h"
+#include "util_boot.h"
+#include "util_dlog.h"
 #include "define_rtos_tasks.h"
 #include "project_defines.h"
 
 static util_dataqueue_t s_dataqueue;
+static util_executor_client_t s_executor_client;
+
+static void s_on_message(util_dataqueue_item_t* dq_i);
+static bool s_boot_info(void);
+static bool s_boot_lcd(void);
+static bool s_boot_spiffs(void);
+static bool s_boot_net(void);
+static bool s_boot_api(void);
+static bool s_boot_clock(void);
+
+// Boot Steps
+// Display First. Info Print, Spiffs, Wifi & Api Run In Parallel With The Panel & Lvgl
+// Module Api & Clock Wait For Wifi Since They Register As Its Notification Targets
+// Lcd Step Runs On The Panel Isr Core, So Panel Setup Needs No Extra Task. The Rest Sit With The Network Stack
+static util_boot_step_t s_boot_steps[] = {
+    {.name = "boot-lcd",    .run = s_boot_lcd,      .core = TASK_CORE_LCD_PANEL_ISR,    .requires = 0,                                          .provides = UTIL_BOOT_READY_LCD},
+    {.name = "boot-info",   .run = s_boot_info,     .core = TASK_CORE_BOOT_STEP,        .requires = 0,                                          .provides = 0},
+    {.name = "boot-spiffs", .run = s_boot_spiffs,   .core = TASK_CORE_BOOT_STEP,        .requires = 0,                                          .provides = UTIL_BOOT_READY_SPIFFS},
+    {.name = "boot-net",    .run = s_boot_net,      .core = TASK_CORE_BOOT_STEP,        .requires = 0,                                          .provides = UTIL_BOOT_READY_NET},
+    {.name = "boot-api",    .run = s_boot_api,      .core = TASK_CORE_BOOT_STEP,        .requires = UTIL_BOOT_READY_NET,                        .provides = UTIL_BOOT_READY_API},
+    {.name = "boot-clock",  .run = s_boot_clock,    .core = TASK_CORE_BOOT_STEP,        .requires = UTIL_BOOT_READY_NET | UTIL_BOOT_READY_API,  .provides = UTIL_BOOT_READY_CLOCK},
+};
 
 void app_main(void)
 {
+    util_dataqueue_item_t dq_i;
+
+    // Boot Timeline Starts Here
+    UTIL_BOOT_Init();
+
     // Initialize NVS
+    // Needed By Wifi & The driver_api Cache Before Any Boot Step Runs
     esp_err_t ret = nvs_flash_init();
     if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
         ESP_ERROR_CHECK(nvs_flash_erase());
@@ -36,11 +70,127 @@ void app_main(void)
     DRIVER_CHIPINFO_Init();
     DRIVER_APPINFO_Init();
 
+    // Set Internal Module Logging
+    esp_log_level_set("wifi", ESP_LOG_NONE);
+    esp_log_level_set("esp_netif_handlers", ESP_LOG_NONE);
+    esp_log_level_set("wifi_init", ESP_LOG_NONE);
+    esp_log_level_set("phy_init", ESP_LOG_NONE);
+    esp_log_level_set("pp", ESP_LOG_NONE);
+    esp_log_level_set("net80211", ESP_LOG_NONE);
+
+    // Main Code Starts
+    ESP_LOGI(DEBUG_TAG_MAIN, "");
+    ESP_LOGI(DEBUG_TAG_MAIN, "Init");
+    ESP_LOGI(DEBUG_TAG_MAIN, "");
+
+    // Start Trace Recorder Before Any Message Is Queued
+    #ifdef CONFIG_TRACE_ENABLE
+    UTIL_TRACE_Init(CONFIG_TRACE_EXPORT_AFTER_S);
+    #endif
+
+    // Start Deferred Log Drain. Hot Path Logs (Dispatch, Vsync, Scan) Are Formatted There
+    UTIL_DLOG_Init();
+
+    // Sample Task Stacks From Boot On, Boot Step Tasks Included
+    #ifdef CONFIG_STACK_BUDGET_ENABLE
+    UTIL_TASKPLAN_StackBudgetStart(CONFIG_STACK_BUDGET_REPORT_AFTER_S);
+    #endif
+
+    // Create Data Queue
+    UTIL_DATAQUEUE_Create(&s_dataqueue, 6);
+
+    // Register Main Dispatch With Executor
+    s_executor_client.name = "main";
+    s_executor_client.core = EXECUTOR_CORE_MAIN;
+    s_executor_client.dq = &s_dataqueue;
+    s_executor_client.on_message = s_on_message;
+    UTIL_EXECUTOR_Register(&s_executor_client);
+
+    // Intialize Drivers & Modules
+    if(!UTIL_BOOT_Run(s_boot_steps, sizeof(s_boot_steps) / sizeof(s_boot_steps[0]))){
+        ESP_LOGE(DEBUG_TAG_MAIN, "Boot Incomplete");
+    }
+
+    ESP_LOGI(DEBUG_TAG_MAIN, "Starting main task");
+
+    // Add Notification Targets
+    // After The Lcd Step Queued LOAD_UI, So Cached Data Lands On A Loaded UI
+    MODULE_WIFI_AddNotificationTarget(&s_dataqueue);
+    MODULE_API_AddNotificationTarget(&s_dataqueue);
+    MODULE_CLOCK_AddNotificationTarget(&s_dataqueue);
+
+    // Set Location Once The Ui Is Loaded
+    if(!UTIL_BOOT_Wait(UTIL_BOOT_READY_UI, pdMS_TO_TICKS(MAIN_BOOT_UI_WAIT_MS))){
+        ESP_LOGW(DEBUG_TAG_MAIN, "Ui Not Ready After %u ms", MAIN_BOOT_UI_WAIT_MS);
+    }
+    MODULE_LCD_SetLocation(DRIVER_API_WEATHER_CITYNAME","DRIVER_API_WEATHER_COUNTRYCODE);
+
+    // Connect To Wifi
+    dq_i.data_type = DATA_TYPE_COMMAND;
+    dq_i.data = MODULE_WIFI_COMMAND_CONNECT;
+    MODULE_WIFI_AddCommand(&dq_i);
+
+    // Start Scheduler
+    // No Need. ESP-IDF Automatically Starts The Scheduler Before main Is Called
+
+    // Main Task Returns Here & Its Stack Is Freed
+    // Notifications Are Dispatched By The Executor (s_on_message)
+    UTIL_BOOT_PrintReport();
+    UTIL_EXECUTOR_PrintStats();
+    UTIL_TASKPLAN_PrintCoreLoad();
+
+    // Periodic Heap / Stack Telemetry
+    DRIVER_CHIPINFO_MemTelemetryStart(DRIVER_CHIPINFO_MEM_SAMPLE_PERIOD_S);
+}
+
+static void s_on_message(util_dataqueue_item_t* dq_i)
+{
+    // Executor Message Handler
+
+    UTIL_DLOGI(DEBUG_TAG_MAIN, "New In DataQueue. Type %u, Data %u", dq_i->data_type, dq_i->data);
+    
+    if(dq_i->data_type == DATA_TYPE_NOTIFICATION)
+    {
+        switch(dq_i->data)
+        {
+            case DRIVER_WIFI_NOTIFICATION_GOT_IP:
+                MODULE_LCD_SetIP(dq_i->data_buff.value.ip);
+                break;
+            
+            case DRIVER_WIFI_NOTIFICATION_LOST_IP:
+            case DRIVER_WIFI_NOTIFICATION_DISCONNECTED:
+                MODULE_LCD_SetIP("");
+                break;
+            
+            case MODULE_CLOCK_NOTIFICATION_TIME_UPDATE:
+                MODULE_LCD_SetTime(&dq_i->data_buff.value.timedata);
+                UTIL_BOOT_Signal(UTIL_BOOT_READY_FIRST_DATA);
+                break;
+            
+            case MODULE_API_NOTIFICATION_WEATHER_UPDATE:
+                MODULE_LCD_SetWeather(&dq_i->data_buff.value.weatherdata);
+                UTIL_BOOT_Signal(UTIL_BOOT_READY_FIRST_DATA);
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+static bool s_boot_info(void)
+{
+    // Boot Step : Print App & Chip Information
+    // Own Step So The Console Output Does Not Delay The Panel
+
     esp_chip_info_t c_info;
     uint32_t size_flash;
     uint32_t size_ram;
     uint8_t* buffer = (uint8_t*)malloc(512);
-    util_dataqueue_item_t dq_i;
+
+    if(!buffer){
+        return false;
+    }
 
     size_flash = DRIVER_CHIPINFO_GetFlashSizeBytes();
     size_ram = DRIVER_CHIPINFO_GetRamSizeBytes();
@@ -75,104 +225,71 @@ void app_main(void)
         (c_info.features & CHIP_FEATURE_BT) ? "BT" : ""
     );
     ESP_LOGI(DEBUG_TAG_MAIN, "FLASH : %u MB", size_flash/(1024 * 1024));
+    ESP_LOGI(DEBUG_TAG_MAIN, "RAM : %u KB (Heap, Internal + Psram)", size_ram/1024);
     ESP_LOGI(DEBUG_TAG_MAIN, "-----------------------------------------------");
 
-    // Set Internal Module Logging
-    esp_log_level_set("wifi", ESP_LOG_NONE);
-    esp_log_level_set("esp_netif_handlers", ESP_LOG_NONE);
-    esp_log_level_set("wifi_init", ESP_LOG_NONE);
-    esp_log_level_set("phy_init", ESP_LOG_NONE);
-    esp_log_level_set("pp", ESP_LOG_NONE);
-    esp_log_level_set("net80211", ESP_LOG_NONE);
+    free(buffer);
+    return true;
+}
 
-    // Main Code Starts
-    ESP_LOGI(DEBUG_TAG_MAIN, "");
-    ESP_LOGI(DEBUG_TAG_MAIN, "Init");
-    ESP_LOGI(DEBUG_TAG_MAIN, "");
+static bool s_boot_lcd(void)
+{
+    // Boot Step : Panel, Lvgl & Ui
+    // Bounce Buffers & The Core 1 Panel Isr Keep Scanout Steady While Wifi Comes Up In Parallel
+
+    if(!DRIVER_LCD_Init()){
+        return false;
+    }
+    MODULE_LCD_Init();
+
+    // Start UI
+    return MODULE_LCD_StartUI();
+}
 
-    // Initialize Spiffs & Filsystem
-    memset((void*)buffer, 0, 512);
-    DRIVER_SPIFFS_Init();
+static bool s_boot_spiffs(void)
+{
+    // Boot Step : Spiffs & Hw Info
+
+    char* buffer;
+    bool ok;
+
+    if(!DRIVER_SPIFFS_Init()){
+        return false;
+    }
     DRIVER_SPIFFS_PrintInfo();
-    if(DRIVER_SPIFFS_ReadFile("/spiff/hw_info.txt", (char*)buffer)){
-        ESP_LOGI(DEBUG_TAG_MAIN, "%s", (char*)buffer);
+
+    buffer = (char*)calloc(1, 512);
+    if(!buffer){
+        return false;
+    }
+    ok = DRIVER_SPIFFS_ReadFile("/spiff/hw_info.txt", buffer);
+    if(ok){
+        ESP_LOGI(DEBUG_TAG_MAIN, "%s", buffer);
     }else{
         ESP_LOGE(DEBUG_TAG_MAIN, "Hw Info Read Failed");
     }
     free(buffer);
 
-    // Create Data Queue
-    UTIL_DATAQUEUE_Create(&s_dataqueue, 6);
-    
-    // Intialize Drivers & Modules
-    // Ensure All Other Peripherals Are Initialized Before Lcd So That Nothing Put Display DMA Out Of Sync
-    DRIVER_WIFI_Init();
-    MODULE_WIFI_Init();
-    DRIVER_API_Init();
-    MODULE_API_Init();
-    DRIVER_LCD_Init();
-    MODULE_LCD_Init();
-
-    // Add Notification Targets
-    MODULE_WIFI_AddNotificationTarget(&s_dataqueue);
-    MODULE_API_AddNotificationTarget(&s_dataqueue);
-
-    ESP_LOGI(DEBUG_TAG_MAIN, "Starting main task");
+    return ok;
+}
 
-    // Start UI
-    MODULE_LCD_StartUI();
+static bool s_boot_net(void)
+{
+    // Boot Step : Netif, Event Loop & Wifi
 
-    vTaskDelay(pdMS_TO_TICKS(250));
-    
-    // Set Location
-    MODULE_LCD_SetLocation(DRIVER_API_WEATHER_CITYNAME","DRIVER_API_WEATHER_COUNTRYCODE);
+    return DRIVER_WIFI_Init() && MODULE_WIFI_Init();
+}
 
-    // Connect To Wifi
-    dq_i.data_type = DATA_TYPE_COMMAND;
-    dq_i.data = MODULE_WIFI_COMMAND_CONNECT;
-    MODULE_WIFI_AddCommand(&dq_i);
+static bool s_boot_api(void)
+{
+    // Boot Step : Api (Registers With driver_wifi)
 
-    // Start Scheduler
-    // No Need. ESP-IDF Automatically Starts The Scheduler Before main Is Called
-    
-    while(true)
-    {
-        if(UTIL_DATAQUEUE_MessageCheck(&s_dataqueue))
-        {
-            if(UTIL_DATAQUEUE_MessageGet(&s_dataqueue, &dq_i, 0))
-            {
-                ESP_LOGI(DEBUG_TAG_MAIN, "New In DataQueue. Type %u, Data %u", dq_i.data_type, dq_i.data);
-                
-                if(dq_i.data_type == DATA_TYPE_NOTIFICATION)
-                {
-                    switch(dq_i.data)
-                    {
-                        case DRIVER_WIFI_NOTIFICATION_GOT_IP:
-                            MODULE_LCD_SetIP(dq_i.data_buff.value.ip);
-                            break;
-                        
-                        case DRIVER_WIFI_NOTIFICATION_LOST_IP:
-                        case DRIVER_WIFI_NOTIFICATION_DISCONNECTED:
-                            MODULE_LCD_SetIP("");
-                            break;
-                        
-                        case MODULE_API_NOTIFICATION_TIME_UPDATE:
-                            MODULE_LCD_SetTime((driver_api_time_info_t *)&dq_i.data_buff.value.timedata);
-                            break;
-                        
-                        case MODULE_API_NOTIFICATION_WEATHER_UPDATE:
-                            MODULE_LCD_SetWeather((driver_api_weather_info_t *)&dq_i.data_buff.value.weatherdata);
-                            break;
-
-                        default:
-                            break;
-                    }
-                }
-            }
-        }
+    return DRIVER_API_Init() && MODULE_API_Init();
+}
 
-        vTaskDelay(pdMS_TO_TICKS(500));
-    }
+static bool s_boot_clock(void)
+{
+    // Boot Step : Clock (Registers With module_wifi & module_api, Needs Netif For Sntp)
 
-    vTaskDelete(NULL);
+    return MODULE_CLOCK_Init();
 }
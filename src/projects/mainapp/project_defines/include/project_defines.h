@@ -8,4 +8,6 @@
 
 #define DEBUG_TAG_MAIN          ("Main")
 
+#define MAIN_BOOT_UI_WAIT_MS    (3000)      // Location Is Set Once The Ui Is Loaded (util_boot)
+
 #endif
\ No newline at end of file
@@ -0,0 +1,265 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <malloc.h>
+#include "sdkconfig.h"
+#include "nvs.h"
+#include "nvs_flash.h"
+#include "esp_log.h"
+#include "esp_http_client.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "driver_api.h"
+#include "define_rtos_tasks.h"
+#include "project_defines.h"
+
+// Replay Scenarios
+// Served By stub/api_stub.py. Names Must Match The Stub Scenario Table
+// weather_conn : Expected Weather Connection Counter Deltas Over The Scenario. -1 = Not Checked
+//                not_modified Needs At Least One 304 (Conditional Request Revalidated)
+typedef struct{
+    int8_t connects;
+    int8_t reuses;
+    bool not_modified;
+}replay_expect_t;
+
+typedef struct{
+    const char* name;
+    uint8_t weather_calls;
+    bool weather_expected;
+    bool time_expected;
+    replay_expect_t weather_conn;
+}replay_scenario_t;
+
+static const replay_scenario_t s_scenarios[] = {
+    { "normal",         2,  true,   true,   {  1,  1, false } },
+    { "chunked",        1,  true,   true,   { -1, -1, false } },
+    { "latency",        1,  true,   true,   { -1, -1, false } },
+    { "oversize",       1,  true,   true,   { -1, -1, false } },
+    { "not_modified",   2,  true,   true,   {  1,  1, true  } },
+    { "conn_close",     2,  true,   true,   {  2,  0, false } },
+    { "malformed",      1,  false,  false,  { -1, -1, false } },
+    { "missing_field",  1,  false,  false,  { -1, -1, false } },
+    { "error_401",      1,  false,  false,  { -1, -1, false } },
+    { "error_500",      1,  false,  false,  { -1, -1, false } },
+    { "drop",           1,  false,  false,  { -1, -1, false } },
+    { "timeout",        1,  false,  false,  { -1, -1, false } },
+};
+
+// Heap Accounting
+// Linker Wraps (main/CMakeLists.txt). Replay Runs In One Task So No Locking
+// Signed. Blocks Allocated Inside libc Can Be Freed Through The Wrapper
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* p, size_t size);
+void __real_free(void* p);
+
+static int64_t s_heap_used;
+static int64_t s_heap_peak;
+
+static void s_heap_add(void* p)
+{
+    // Account Allocated Block
+
+    if(p){
+        s_heap_used += malloc_usable_size(p);
+        if(s_heap_used > s_heap_peak){
+            s_heap_peak = s_heap_used;
+        }
+    }
+}
+
+void* __wrap_malloc(size_t size)
+{
+    // Malloc Wrapper
+
+    void* p = __real_malloc(size);
+
+    s_heap_add(p);
+    return p;
+}
+
+void* __wrap_calloc(size_t n, size_t size)
+{
+    // Calloc Wrapper
+
+    void* p = __real_calloc(n, size);
+
+    s_heap_add(p);
+    return p;
+}
+
+void* __wrap_realloc(void* p, size_t size)
+{
+    // Realloc Wrapper
+
+    size_t size_old = p ? malloc_usable_size(p) : 0;
+    void* q = __real_realloc(p, size);
+
+    if(q || size == 0){
+        s_heap_used -= size_old;
+        s_heap_add(q);
+    }
+    return q;
+}
+
+void __wrap_free(void* p)
+{
+    // Free Wrapper
+
+    if(p){
+        s_heap_used -= malloc_usable_size(p);
+    }
+    __real_free(p);
+}
+
+static bool s_scenario_select(const char* name)
+{
+    // Ask The Stub To Replay Scenario For Following Requests
+
+    char url[64];
+    esp_http_client_handle_t handle;
+    esp_err_t err;
+    int status;
+
+    snprintf(url, sizeof(url), "%s%s", REPLAY_STUB_CONTROL_URL, name);
+
+    esp_http_client_config_t config = {
+        .url = url,
+        .method = HTTP_METHOD_GET,
+        .timeout_ms = 1000,
+    };
+    handle = esp_http_client_init(&config);
+    if(!handle){
+        return false;
+    }
+    err = esp_http_client_perform(handle);
+    status = esp_http_client_get_status_code(handle);
+    esp_http_client_cleanup(handle);
+
+    return (err == ESP_OK) && (status == 200);
+}
+
+static bool s_scenario_check(const char* name, const char* host_name, driver_api_host_t host, bool result, bool expected, const driver_api_conn_stats_t* before, const replay_expect_t* ex, int64_t heap_peak)
+{
+    // Compare Result & Connection Counter Deltas, Print Scenario Metrics
+    // A Fetch That Succeeds Without Reusing Its Connection Or Revalidating Still Fails The Scenario
+
+    driver_api_conn_stats_t st;
+    uint32_t connects;
+    uint32_t reuses;
+    uint32_t not_modified;
+    double mb_per_s = 0;
+    bool ok = (result == expected);
+
+    DRIVER_API_GetConnStats(host, &st);
+    if(st.parse_us_last > 0){
+        mb_per_s = (double)st.body_bytes_last / (double)st.parse_us_last;
+    }
+    connects = st.connects - before->connects;
+    reuses = st.reuses - before->reuses;
+    not_modified = st.not_modified - before->not_modified;
+
+    if(ex->connects >= 0 && connects != (uint32_t)ex->connects){
+        ok = false;
+    }
+    if(ex->reuses >= 0 && reuses != (uint32_t)ex->reuses){
+        ok = false;
+    }
+    if(ex->not_modified && not_modified == 0){
+        ok = false;
+    }
+
+    ESP_LOGI(DEBUG_TAG_MAIN, "%-14s %-8s %-4s Latency %5" PRIu32 " ms, Body %6" PRIu32 " B, Parse %6" PRIu32 " us (%6.2f MB/s), Heap Peak %6u B, Connect +%" PRIu32 " Reuse +%" PRIu32 " 304 +%" PRIu32,
+        name,
+        host_name,
+        ok ? "PASS" : "FAIL",
+        st.latency_last_ms,
+        st.body_bytes_last,
+        st.parse_us_last,
+        mb_per_s,
+        (unsigned)heap_peak,
+        connects,
+        reuses,
+        not_modified
+    );
+    if(!ok && result == expected){
+        ESP_LOGE(DEBUG_TAG_MAIN, "%-14s %-8s Expected Connect +%d Reuse +%d%s",
+            name,
+            host_name,
+            ex->connects,
+            ex->reuses,
+            ex->not_modified ? " & A 304" : ""
+        );
+    }
+
+    return ok;
+}
+
+void app_main(void)
+{
+    // Initialize NVS
+    esp_err_t ret = nvs_flash_init();
+    if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        ESP_ERROR_CHECK(nvs_flash_erase());
+        ret = nvs_flash_init();
+    }
+    ESP_ERROR_CHECK(ret);
+
+    // Main Code Starts
+    ESP_LOGI(DEBUG_TAG_MAIN, "");
+    ESP_LOGI(DEBUG_TAG_MAIN, "%s. Git %s", PROJECT_NAME, GIT_HASH);
+    ESP_LOGI(DEBUG_TAG_MAIN, "");
+
+    DRIVER_API_Init();
+
+    driver_api_weather_info_t weather;
+    driver_api_time_info_t time;
+    const replay_scenario_t* sc;
+    const replay_expect_t none = { -1, -1, false };
+    driver_api_conn_stats_t before;
+    int64_t heap_base;
+    uint8_t failures = 0;
+    bool result;
+
+    for(uint8_t i = 0; i < sizeof(s_scenarios) / sizeof(s_scenarios[0]); i++){
+        sc = &s_scenarios[i];
+
+        if(!s_scenario_select(sc->name)){
+            ESP_LOGE(DEBUG_TAG_MAIN, "Stub Not Reachable. Start stub/api_stub.py");
+            exit(2);
+        }
+
+        // Weather. Repeated Calls Exercise Connection Reuse & Revalidation
+        DRIVER_API_GetConnStats(DRIVER_API_HOST_WEATHER, &before);
+        heap_base = s_heap_used;
+        s_heap_peak = s_heap_used;
+        result = false;
+        for(uint8_t n = 0; n < sc->weather_calls; n++){
+            result = DRIVER_API_GetWeather(&weather);
+        }
+        if(!s_scenario_check(sc->name, "weather", DRIVER_API_HOST_WEATHER, result, sc->weather_expected, &before, &sc->weather_conn, s_heap_peak - heap_base)){
+            failures += 1;
+        }
+
+        // Time
+        DRIVER_API_GetConnStats(DRIVER_API_HOST_TIME, &before);
+        heap_base = s_heap_used;
+        s_heap_peak = s_heap_used;
+        result = DRIVER_API_GetTime(&time);
+        if(!s_scenario_check(sc->name, "time", DRIVER_API_HOST_TIME, result, sc->time_expected, &before, &none, s_heap_peak - heap_base)){
+            failures += 1;
+        }
+
+        // Every Scenario Starts On A Fresh Connection
+        DRIVER_API_CloseAll();
+    }
+
+    DRIVER_API_PrintConnStats();
+    ESP_LOGI(DEBUG_TAG_MAIN, "%u Scenarios, %u Failures", (unsigned)(sizeof(s_scenarios) / sizeof(s_scenarios[0])), failures);
+
+    exit(failures ? 1 : 0);
+}
@@ -0,0 +1,14 @@
+// PROJECT DEFINES
+// OCTOBER 19, 2026
+
+#ifndef _PROJECT_DEFINES_
+#define _PROJECT_DEFINES_
+
+#define PROJECT_NAME            ("Test_Api_Replay")
+
+#define DEBUG_TAG_MAIN          ("Main")
+
+// Stub Server Control Endpoint. Selects The Scenario Replayed By Following Requests
+#define REPLAY_STUB_CONTROL_URL ("http://127.0.0.1:8080/_scenario/")
+
+#endif
@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+
+# Api Stub
+# 10/19/26
+
+# Local Http Stub For The driver_api Replay Harness (projects/test_api_replay)
+# Replays Recorded Openweather / Timezonedb Payloads From payloads/
+# GET /_scenario/<name> Selects How Following Requests Are Answered
+
+import json
+import os
+import sys
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+PORT = 8080
+PAYLOAD_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "payloads")
+ETAG = '"replay-1"'
+
+# Scenario Table
+# latency_s     : Delay Before The Status Line
+# chunk         : Chunked Transfer Encoding With This Chunk Size (0 = Content-Length)
+# chunk_delay_s : Delay Between Chunks
+# status        : Http Status. Body From The <host>_<status>.json Payload When Present
+# body          : normal | oversize | malformed | missing_field
+# close         : Connection: close After Every Response
+# drop          : Close The Socket After Sending This Many Body Bytes
+# etag          : Send ETag & Answer A Matching If-None-Match With 304
+SCENARIOS = {
+    "normal":           {},
+    "chunked":          {"chunk": 16, "chunk_delay_s": 0.005},
+    "latency":          {"latency_s": 1.5},
+    "oversize":         {"body": "oversize"},
+    "not_modified":     {"etag": True},
+    "conn_close":       {"close": True},
+    "malformed":        {"body": "malformed"},
+    "missing_field":    {"body": "missing_field"},
+    "error_401":        {"status": 401},
+    "error_500":        {"status": 500},
+    "drop":             {"drop": 64},
+    "timeout":          {"latency_s": 6.0},
+}
+
+# Oversize Body. A Large Unused Array Ahead Of The Real Fields
+OVERSIZE_PAD_ITEMS = 4096
+
+state = {"scenario": "normal"}
+
+
+def payload_load(name):
+    # Load Recorded Payload
+
+    with open(os.path.join(PAYLOAD_DIR, name), "rb") as f:
+        return f.read().strip()
+
+
+def body_build(host, sc):
+    # Build Response Body For Host & Scenario
+
+    status = sc.get("status", 200)
+    if status != 200:
+        name = "%s_%d.json" % (host, status)
+        if os.path.exists(os.path.join(PAYLOAD_DIR, name)):
+            return payload_load(name)
+        return b"Internal Server Error"
+
+    body = payload_load(host + ".json")
+    kind = sc.get("body", "normal")
+
+    if kind == "oversize":
+        doc = json.loads(body)
+        doc["list"] = [{"dt": 1760861125 + i * 3600, "temp": 27.46, "pop": 0.2} for i in range(OVERSIZE_PAD_ITEMS)]
+        # Padding First So The Parser Has To Skip It Before The Real Fields
+        doc = {"list": doc.pop("list"), **doc}
+        body = json.dumps(doc, separators=(",", ":")).encode()
+    elif kind == "malformed":
+        body = body[: len(body) // 2]
+    elif kind == "missing_field":
+        doc = json.loads(body)
+        if host == "weather":
+            del doc["main"]["temp"]
+        else:
+            del doc["timestamp"]
+        body = json.dumps(doc, separators=(",", ":")).encode()
+
+    return body
+
+
+class StubHandler(BaseHTTPRequestHandler):
+    # Keep-Alive Like The Real Hosts
+    protocol_version = "HTTP/1.1"
+
+    def log_message(self, fmt, *args):
+        sys.stderr.write("[stub] %s %s\n" % (state["scenario"], fmt % args))
+
+    def do_GET(self):
+        # Request Handler
+
+        if self.path.startswith("/_scenario/"):
+            name = self.path[len("/_scenario/"):]
+            if name not in SCENARIOS:
+                self.s_reply(404, b"Unknown Scenario", {}, close=True)
+                return
+            state["scenario"] = name
+            self.s_reply(200, b"OK", {}, close=True)
+            return
+
+        if self.path.startswith("/data/2.5/weather"):
+            host = "weather"
+        elif self.path.startswith("/v2.1/get-time-zone"):
+            host = "time"
+        else:
+            self.s_reply(404, b"Not Found", {}, close=False)
+            return
+
+        sc = SCENARIOS[state["scenario"]]
+        time.sleep(sc.get("latency_s", 0))
+
+        headers = {"Content-Type": "application/json; charset=utf-8"}
+        if sc.get("etag") and host == "weather":
+            headers["ETag"] = ETAG
+            if self.headers.get("If-None-Match") == ETAG:
+                self.s_reply(304, b"", headers, close=sc.get("close", False))
+                return
+
+        body = body_build(host, sc)
+        status = sc.get("status", 200)
+
+        if sc.get("drop"):
+            # Advertise The Full Length, Then Hang Up Mid Body
+            self.send_response(status)
+            for k, v in headers.items():
+                self.send_header(k, v)
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+            self.wfile.write(body[: sc["drop"]])
+            self.wfile.flush()
+            self.close_connection = True
+            return
+
+        if sc.get("chunk"):
+            self.send_response(status)
+            for k, v in headers.items():
+                self.send_header(k, v)
+            self.send_header("Transfer-Encoding", "chunked")
+            if sc.get("close"):
+                self.send_header("Connection", "close")
+            self.end_headers()
+            step = sc["chunk"]
+            for i in range(0, len(body), step):
+                part = body[i : i + step]
+                self.wfile.write(b"%x\r\n%s\r\n" % (len(part), part))
+                self.wfile.flush()
+                time.sleep(sc.get("chunk_delay_s", 0))
+            self.wfile.write(b"0\r\n\r\n")
+            self.close_connection = sc.get("close", False)
+            return
+
+        self.s_reply(status, body, headers, close=sc.get("close", False))
+
+    def s_reply(self, status, body, headers, close):
+        # Plain Content-Length Response
+
+        self.send_response(status)
+        for k, v in headers.items():
+            self.send_header(k, v)
+        self.send_header("Content-Length", str(len(body)))
+        if close:
+            self.send_header("Connection", "close")
+        self.end_headers()
+        self.wfile.write(body)
+        self.close_connection = close
+
+
+def main():
+    port = int(sys.argv[1]) if len(sys.argv) > 1 else PORT
+    server = ThreadingHTTPServer(("127.0.0.1", port), StubHandler)
+    sys.stderr.write("[stub] Listening On 127.0.0.1:%d\n" % port)
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
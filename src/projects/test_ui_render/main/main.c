@@ -0,0 +1,329 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <time.h>
+#include <sys/stat.h>
+#include "sdkconfig.h"
+#include "esp_log.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "lvgl.h"
+
+#include "driver_lcd.h"
+#include "util_dataqueue.h"
+#include "ui_img_assets.h"
+#include "ui_png.h"
+#include "project_defines.h"
+
+// Scripted Frames
+// Each Step Posts At Most One Command Through DRIVER_LCD_AddCommand, Advances The Lvgl Tick & Renders One Frame
+// idle : Nothing On Screen May Change (Widget Binding Must Drop The Update)
+// iters : Lvgl Task Iterations Before The Frame, One Theme Preload Chunk Each
+#define UI_RENDER_NO_COMMAND            (0xFF)
+#define UI_RENDER_TS                    (1760861125)        // Sun Oct 19 2025 08:05:25 Utc
+#define UI_RENDER_GMT_OFFSET            (-14400)            // 04:05 AM Local
+#define UI_RENDER_SUNRISE               (1760872800)
+#define UI_RENDER_SUNSET                (1760912400)
+// Iterations To Copy One Background Into A Theme Slot (Then One More To Swap)
+#define UI_RENDER_THEME_ITERS           (((DRIVER_LCD_DISPLAY_HRES * DRIVER_LCD_DISPLAY_VRES * 2) + DRIVER_LCD_THEME_CHUNK_BYTES - 1) / DRIVER_LCD_THEME_CHUNK_BYTES)
+
+typedef struct{
+    const char* name;
+    util_dataqueue_item_t item;
+    uint32_t advance_ms;
+    bool blink;
+    bool idle;
+    uint8_t iters;
+}ui_render_step_t;
+
+typedef struct{
+    uint64_t render_us;
+    uint32_t pixels;
+    uint32_t areas;
+    uint32_t mem_used;
+    uint32_t mem_max_used;
+}ui_render_frame_t;
+
+#define UI_RENDER_CMD(c)                .item = { .data = (c), .data_type = DATA_TYPE_COMMAND }
+#define UI_RENDER_CMD_IP(s)             .item = { .data = DRIVER_LCD_COMMAND_SET_IP, .data_type = DATA_TYPE_COMMAND, .data_buff.value.ip = s }
+#define UI_RENDER_CMD_LOCATION(s)       .item = { .data = DRIVER_LCD_COMMAND_SET_LOCATION, .data_type = DATA_TYPE_COMMAND, .data_buff.value.location = s }
+#define UI_RENDER_CMD_TIME(t)           .item = { .data = DRIVER_LCD_COMMAND_SET_TIME, .data_type = DATA_TYPE_COMMAND, .data_buff.value.timedata = { (t), UI_RENDER_GMT_OFFSET } }
+#define UI_RENDER_CMD_WEATHER(c, h)     .item = { .data = DRIVER_LCD_COMMAND_SET_WEATHER, .data_type = DATA_TYPE_COMMAND, .data_buff.value.weatherdata = { (c), (h), 800, UI_RENDER_SUNRISE, UI_RENDER_SUNSET } }
+
+static const ui_render_step_t s_steps[] = {
+    { "boot",               UI_RENDER_CMD(DRIVER_LCD_COMMAND_LOAD_UI),          0,      false,  false,  1                           },
+    { "ip_up",              UI_RENDER_CMD_IP("192.168.1.42"),                   50,     false,  false,  1                           },
+    { "location",           UI_RENDER_CMD_LOCATION("Toronto"),                  50,     false,  false,  1                           },
+    { "time",               UI_RENDER_CMD_TIME(UI_RENDER_TS),                   50,     false,  false,  1                           },
+    { "theme_loading",      UI_RENDER_CMD(UI_RENDER_NO_COMMAND),                1000,   false,  true,   UI_RENDER_THEME_ITERS - 1   },
+    { "theme_swap",         UI_RENDER_CMD(UI_RENDER_NO_COMMAND),                50,     false,  false,  1                           },
+    { "weather",            UI_RENDER_CMD_WEATHER(2746, 62),                    50,     false,  false,  1                           },
+    { "time_same_minute",   UI_RENDER_CMD_TIME(UI_RENDER_TS + 1),               1000,   false,  true,   1                           },
+    { "weather_same",       UI_RENDER_CMD_WEATHER(2731, 62),                    50,     false,  true,   1                           },
+    { "ip_same",            UI_RENDER_CMD_IP("192.168.1.42"),                   50,     false,  true,   1                           },
+    { "blink_off",          UI_RENDER_CMD(UI_RENDER_NO_COMMAND),                1000,   true,   false,  1                           },
+    { "blink_on",           UI_RENDER_CMD(UI_RENDER_NO_COMMAND),                1000,   true,   false,  1                           },
+    { "minute",             UI_RENDER_CMD_TIME(UI_RENDER_TS + 35),              1000,   false,  false,  1                           },
+    { "weather_change",     UI_RENDER_CMD_WEATHER(1890, 71),                    50,     false,  false,  1                           },
+    { "ip_lost",            UI_RENDER_CMD_IP(""),                               50,     false,  false,  1                           },
+    { "ip_back",            UI_RENDER_CMD_IP("192.168.1.42"),                   50,     false,  false,  1                           },
+    { "noon",               UI_RENDER_CMD_TIME(UI_RENDER_TS + (8 * 3600)),      50,     false,  false,  1                           },
+    { "noon_theme",         UI_RENDER_CMD(UI_RENDER_NO_COMMAND),                1000,   false,  false,  UI_RENDER_THEME_ITERS       },
+    // Night Still In The Other Slot. Swapped Without Reloading
+    { "day_rollover",       UI_RENDER_CMD_TIME(UI_RENDER_TS + (20 * 3600)),     50,     false,  false,  1                           },
+};
+
+// Headless Display
+static util_dataqueue_t s_dataqueue;
+static lv_display_t* s_display;
+static uint8_t s_draw_buf[2][UI_RENDER_DRAW_BUF_BYTES];
+static uint16_t s_framebuffer[DRIVER_LCD_DISPLAY_HRES * DRIVER_LCD_DISPLAY_VRES];
+static uint8_t s_rgb[DRIVER_LCD_DISPLAY_HRES * DRIVER_LCD_DISPLAY_VRES * 3];
+static uint8_t s_golden[DRIVER_LCD_DISPLAY_HRES * DRIVER_LCD_DISPLAY_VRES * 3];
+static uint32_t s_tick_ms;
+static ui_render_frame_t s_frame;
+
+static uint32_t s_tick_get_cb(void)
+{
+    // Virtual Lvgl Tick. Advanced By The Script So Frames Are Deterministic
+
+    return s_tick_ms;
+}
+
+static void s_flush_cb(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map)
+{
+    // Copy Rendered Area Into The Framebuffer & Count Pixels
+
+    int32_t w = lv_area_get_width(area);
+    const uint16_t* src = (const uint16_t*)px_map;
+
+    for(int32_t y = area->y1; y <= area->y2; y++){
+        memcpy(&s_framebuffer[(y * DRIVER_LCD_DISPLAY_HRES) + area->x1], src, w * sizeof(uint16_t));
+        src += w;
+    }
+
+    s_frame.pixels += lv_area_get_size(area);
+    s_frame.areas += 1;
+
+    lv_display_flush_ready(disp);
+}
+
+static void s_display_create(void)
+{
+    // Lvgl Display Without A Panel. Same Size, Format, Rotation & Render Mode As driver_lcd
+    // s_flush_cb Copies Areas Unrotated Like driver_lcd's, So Goldens Are The Device Framebuffer
+
+    lv_init();
+    lv_tick_set_cb(s_tick_get_cb);
+
+    s_display = lv_display_create(DRIVER_LCD_DISPLAY_HRES, DRIVER_LCD_DISPLAY_VRES);
+    assert(s_display);
+    lv_display_set_buffers(s_display, s_draw_buf[0], s_draw_buf[1], UI_RENDER_DRAW_BUF_BYTES, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_color_format(s_display, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_rotation(s_display, DRIVER_LCD_DISPLAY_ROTATION);
+    lv_display_set_flush_cb(s_display, s_flush_cb);
+}
+
+bool DRIVER_LCD_AddCommand(util_dataqueue_item_t* dq_i)
+{
+    // Mock. Same Queue Semantics As driver_lcd, Drained By s_lcd_iter
+
+    return UTIL_DATAQUEUE_MessageQueue(&s_dataqueue, dq_i, 0);
+}
+
+static void s_lcd_iter(bool blink)
+{
+    // One Lvgl Task Iteration (Command Side)
+    // Same driver_lcd_ui.c Calls As The Lvgl Task. Only The Panel Side Is Left Out
+
+    util_dataqueue_item_t dq_i;
+
+    while(UTIL_DATAQUEUE_MessageGet(&s_dataqueue, &dq_i, 0)){
+        DRIVER_LCD_UI_Command(&dq_i);
+    }
+
+    // Second Indicator
+    if(blink){
+        DRIVER_LCD_UI_SecondToggle();
+    }
+
+    // Background Theme
+    DRIVER_LCD_UI_Service();
+}
+
+static uint64_t s_now_us(void)
+{
+    // Host Monotonic Clock
+
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000ULL) + (ts.tv_nsec / 1000);
+}
+
+static void s_frame_render(uint32_t advance_ms)
+{
+    // Render One Frame & Record Its Metrics
+
+    lv_mem_monitor_t mon;
+    uint64_t start;
+
+    memset(&s_frame, 0, sizeof(s_frame));
+    s_tick_ms += advance_ms;
+
+    // Layout & Draw Of Everything Invalidated Since The Last Frame
+    start = s_now_us();
+    lv_timer_handler();
+    lv_refr_now(s_display);
+    s_frame.render_us = s_now_us() - start;
+
+    lv_mem_monitor(&mon);
+    s_frame.mem_used = mon.total_size - mon.free_size;
+    s_frame.mem_max_used = mon.max_used;
+}
+
+static void s_frame_to_rgb(void)
+{
+    // Framebuffer Rgb565 -> Rgb888
+
+    uint16_t c;
+    uint8_t* p = s_rgb;
+
+    for(uint32_t i = 0; i < DRIVER_LCD_DISPLAY_HRES * DRIVER_LCD_DISPLAY_VRES; i++){
+        c = s_framebuffer[i];
+        *p++ = ((c >> 11) & 0x1F) << 3 | ((c >> 13) & 0x07);
+        *p++ = ((c >> 5) & 0x3F) << 2 | ((c >> 9) & 0x03);
+        *p++ = (c & 0x1F) << 3 | ((c >> 2) & 0x07);
+    }
+}
+
+static bool s_golden_check(const char* name, bool record, uint32_t* diff)
+{
+    // Compare Frame Against golden/<name>.png Or Record It
+    // Mismatching Frames Are Written To build/ui_render/ For Inspection
+
+    char path[96];
+    int16_t d;
+
+    s_frame_to_rgb();
+    *diff = 0;
+
+    snprintf(path, sizeof(path), "%s/%s.png", UI_RENDER_GOLDEN_DIR, name);
+    if(record){
+        return UI_PNG_Write(path, s_rgb, DRIVER_LCD_DISPLAY_HRES, DRIVER_LCD_DISPLAY_VRES);
+    }
+
+    if(!UI_PNG_Read(path, s_golden, DRIVER_LCD_DISPLAY_HRES, DRIVER_LCD_DISPLAY_VRES)){
+        ESP_LOGE(DEBUG_TAG_MAIN, "%s Missing Or Unreadable. Run With UI_RENDER_RECORD=1", path);
+        *diff = DRIVER_LCD_DISPLAY_HRES * DRIVER_LCD_DISPLAY_VRES;
+        return false;
+    }
+
+    for(uint32_t i = 0; i < DRIVER_LCD_DISPLAY_HRES * DRIVER_LCD_DISPLAY_VRES; i++){
+        for(uint8_t ch = 0; ch < 3; ch++){
+            d = (int16_t)s_rgb[(i * 3) + ch] - (int16_t)s_golden[(i * 3) + ch];
+            if(d > UI_RENDER_GOLDEN_TOLERANCE || d < -UI_RENDER_GOLDEN_TOLERANCE){
+                *diff += 1;
+                break;
+            }
+        }
+    }
+
+    if(*diff > UI_RENDER_GOLDEN_DIFF_MAX){
+        snprintf(path, sizeof(path), "%s/%s.png", UI_RENDER_OUTPUT_DIR, name);
+        UI_PNG_Write(path, s_rgb, DRIVER_LCD_DISPLAY_HRES, DRIVER_LCD_DISPLAY_VRES);
+        return false;
+    }
+
+    return true;
+}
+
+void app_main(void)
+{
+    // Main Code Starts
+    ESP_LOGI(DEBUG_TAG_MAIN, "");
+    ESP_LOGI(DEBUG_TAG_MAIN, "%s. Git %s", PROJECT_NAME, GIT_HASH);
+    ESP_LOGI(DEBUG_TAG_MAIN, "");
+
+    const ui_render_step_t* st;
+    util_dataqueue_item_t dq_i;
+    driver_lcd_bind_stats_t bind_stats;
+    bool record = (getenv("UI_RENDER_RECORD") != NULL);
+    uint64_t render_us_total = 0;
+    uint64_t render_us_max = 0;
+    uint32_t pixels_total = 0;
+    uint32_t diff;
+    uint8_t failures = 0;
+    bool golden_ok;
+    bool idle_ok;
+
+    mkdir(UI_RENDER_GOLDEN_DIR, 0755);
+    mkdir("build", 0755);
+    mkdir(UI_RENDER_OUTPUT_DIR, 0755);
+
+    UTIL_DATAQUEUE_Create(&s_dataqueue, DRIVER_LCD_DATAQUEUE_MAX);
+    assert(s_dataqueue.handle);
+
+    DRIVER_LCD_UI_Init();
+
+    s_display_create();
+    if(!UI_IMG_ASSETS_Init()){
+        exit(1);
+    }
+
+    for(uint8_t i = 0; i < sizeof(s_steps) / sizeof(s_steps[0]); i++){
+        st = &s_steps[i];
+
+        if(st->item.data != UI_RENDER_NO_COMMAND){
+            dq_i = st->item;
+            DRIVER_LCD_AddCommand(&dq_i);
+        }
+        s_lcd_iter(st->blink);
+        for(uint8_t n = 1; n < st->iters; n++){
+            s_lcd_iter(false);
+        }
+        s_frame_render(st->advance_ms);
+
+        idle_ok = !st->idle || (s_frame.pixels == 0);
+        golden_ok = s_golden_check(st->name, record, &diff);
+        if(!idle_ok || !golden_ok){
+            failures += 1;
+        }
+
+        render_us_total += s_frame.render_us;
+        if(s_frame.render_us > render_us_max){
+            render_us_max = s_frame.render_us;
+        }
+        pixels_total += s_frame.pixels;
+
+        ESP_LOGI(DEBUG_TAG_MAIN, "%-18s %-4s Render %6" PRIu64 " us, Pixels %6" PRIu32 " (%3" PRIu32 " %%) In %2" PRIu32 " Areas, Lvgl Mem %6" PRIu32 " B (Max %6" PRIu32 " B), Golden %s (%" PRIu32 " Px)%s",
+            st->name,
+            (idle_ok && golden_ok) ? "PASS" : "FAIL",
+            s_frame.render_us,
+            s_frame.pixels,
+            (s_frame.pixels * 100) / (DRIVER_LCD_DISPLAY_HRES * DRIVER_LCD_DISPLAY_VRES),
+            s_frame.areas,
+            s_frame.mem_used,
+            s_frame.mem_max_used,
+            record ? "Recorded" : (golden_ok ? "Match" : "Differs"),
+            diff,
+            idle_ok ? "" : ". Expected Idle Frame"
+        );
+    }
+
+    DRIVER_LCD_GetBindStats(&bind_stats);
+    ESP_LOGI(DEBUG_TAG_MAIN, "%u Frames, %u Failures. Render Total %" PRIu64 " us, Max %" PRIu64 " us, Pixels %" PRIu32 ". Bind Updates %" PRIu32 ", Suppressed %" PRIu32,
+        (unsigned)(sizeof(s_steps) / sizeof(s_steps[0])),
+        failures,
+        render_us_total,
+        render_us_max,
+        pixels_total,
+        bind_stats.updates,
+        bind_stats.suppressed
+    );
+
+    exit(failures ? 1 : 0);
+}
@@ -0,0 +1,83 @@
+// UI IMG ASSETS
+// OCTOBER 19, 2026
+
+// Backgrounds The SquareLine Export Lists But Does Not Ship As Source (ui_img_images_img_clear_*_png.c)
+// Decoded At Startup From The Project Assets (project_ui/assets/images), So Goldens Show The Real Art
+// Opaque Png -> Rgb565 By Truncation, Like The Export's Rgb565 Images
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "esp_log.h"
+#include "lvgl.h"
+
+#include "driver_lcd.h"
+#include "ui_img_assets.h"
+#include "ui_png.h"
+#include "project_defines.h"
+
+#define UI_IMG_ASSETS_PIXELS            (DRIVER_LCD_DISPLAY_HRES * DRIVER_LCD_DISPLAY_VRES)
+
+// Local Variables
+static uint16_t s_clear_day_px[UI_IMG_ASSETS_PIXELS];
+static uint16_t s_clear_night_px[UI_IMG_ASSETS_PIXELS];
+
+// Local Functions
+static bool s_load(const char* name, uint16_t* px);
+
+// External Variables
+const lv_image_dsc_t ui_img_images_img_clear_day_png = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.w = DRIVER_LCD_DISPLAY_HRES,
+    .header.h = DRIVER_LCD_DISPLAY_VRES,
+    .header.stride = DRIVER_LCD_DISPLAY_HRES * 2,
+    .data_size = sizeof(s_clear_day_px),
+    .data = (const uint8_t*)s_clear_day_px,
+};
+
+const lv_image_dsc_t ui_img_images_img_clear_night_png = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.w = DRIVER_LCD_DISPLAY_HRES,
+    .header.h = DRIVER_LCD_DISPLAY_VRES,
+    .header.stride = DRIVER_LCD_DISPLAY_HRES * 2,
+    .data_size = sizeof(s_clear_night_px),
+    .data = (const uint8_t*)s_clear_night_px,
+};
+
+// External Functions
+bool UI_IMG_ASSETS_Init(void)
+{
+    // Load Background Assets
+    // Call After lv_init (UI_PNG_Read) & Before ui_init
+
+    if(!s_load("img_clear_day.png", s_clear_day_px)) return false;
+    if(!s_load("img_clear_night.png", s_clear_night_px)) return false;
+
+    return true;
+}
+
+static bool s_load(const char* name, uint16_t* px)
+{
+    // Decode Display Sized Png Asset To Rgb565
+
+    uint8_t* rgb = (uint8_t*)malloc(UI_IMG_ASSETS_PIXELS * 3);
+    const uint8_t* p = rgb;
+    char path[128];
+    bool ok;
+
+    snprintf(path, sizeof(path), "%s/%s", UI_RENDER_ASSET_DIR, name);
+    ok = rgb && UI_PNG_Read(path, rgb, DRIVER_LCD_DISPLAY_HRES, DRIVER_LCD_DISPLAY_VRES);
+    if(ok){
+        for(uint32_t i = 0; i < UI_IMG_ASSETS_PIXELS; i++){
+            px[i] = (uint16_t)(((p[0] & 0xF8) << 8) | ((p[1] & 0xFC) << 3) | (p[2] >> 3));
+            p += 3;
+        }
+    }else{
+        ESP_LOGE(DEBUG_TAG_MAIN, "%s Missing Or Not A %ux%u Png", path, DRIVER_LCD_DISPLAY_HRES, DRIVER_LCD_DISPLAY_VRES);
+    }
+    free(rgb);
+
+    return ok;
+}
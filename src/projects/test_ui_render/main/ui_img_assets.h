@@ -0,0 +1,11 @@
+// UI IMG ASSETS
+// OCTOBER 19, 2026
+
+#ifndef _UI_IMG_ASSETS_
+#define _UI_IMG_ASSETS_
+
+#include <stdbool.h>
+
+bool UI_IMG_ASSETS_Init(void);
+
+#endif
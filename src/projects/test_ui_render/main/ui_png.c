@@ -0,0 +1,124 @@
+// UI PNG
+// OCTOBER 19, 2026
+
+// Png File Helpers For Golden Frames & Assets. Rgb888, Fixed Size
+// Lvgl's lodepng Decodes Into An lv_draw_buf From The Image Handlers, Pointed At libc While Decoding
+// Png Buffers Never Come From The Lvgl Pool, So The Lvgl Memory High Water Mark Stays The Ui's Own
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lvgl.h"
+#include "libs/lodepng/lodepng.h"
+#include "draw/lv_draw_buf_private.h"
+
+#include "ui_png.h"
+
+// Local Functions
+static void* s_buf_malloc_cb(size_t size, lv_color_format_t cf);
+static void s_buf_free_cb(void* p);
+
+// External Functions
+void* lodepng_malloc(size_t size)
+{
+    // Png Allocator (LODEPNG_NO_COMPILE_ALLOCATORS)
+
+    return malloc(size);
+}
+
+void* lodepng_realloc(void* p, size_t size)
+{
+    // Png Allocator
+
+    return realloc(p, size);
+}
+
+void lodepng_free(void* p)
+{
+    // Png Allocator
+
+    free(p);
+}
+
+bool UI_PNG_Read(const char* path, uint8_t* rgb, uint32_t w, uint32_t h)
+{
+    // Decode A w x h Png File To Rgb888
+    // Call After lv_init (Image Handlers Exist)
+
+    lv_draw_buf_handlers_t* handlers = lv_draw_buf_get_image_handlers();
+    lv_draw_buf_malloc_cb_t malloc_cb = handlers->buf_malloc_cb;
+    lv_draw_buf_free_cb_t free_cb = handlers->buf_free_cb;
+    lv_draw_buf_t* decoded = NULL;
+    unsigned char* png;
+    unsigned png_w, png_h;
+    bool ok = false;
+    long size;
+    FILE* f;
+
+    f = fopen(path, "rb");
+    if(!f){
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    handlers->buf_malloc_cb = s_buf_malloc_cb;
+    handlers->buf_free_cb = s_buf_free_cb;
+
+    png = malloc(size);
+    if(png && fread(png, 1, size, f) == (size_t)size){
+        if(lodepng_decode24((unsigned char**)&decoded, &png_w, &png_h, png, size) == 0 && png_w == w && png_h == h){
+            // Packed Rgb888 At The Start Of The Buffer
+            memcpy(rgb, decoded->data, w * h * 3);
+            ok = true;
+        }
+    }
+    if(decoded){
+        lv_draw_buf_destroy(decoded);
+    }
+    free(png);
+    fclose(f);
+
+    handlers->buf_malloc_cb = malloc_cb;
+    handlers->buf_free_cb = free_cb;
+
+    return ok;
+}
+
+bool UI_PNG_Write(const char* path, const uint8_t* rgb, uint32_t w, uint32_t h)
+{
+    // Encode Rgb888 To A Png File
+
+    unsigned char* png = NULL;
+    size_t png_size = 0;
+    FILE* f;
+    bool ok = false;
+
+    if(lodepng_encode24(&png, &png_size, rgb, w, h) == 0){
+        f = fopen(path, "wb");
+        if(f){
+            ok = (fwrite(png, 1, png_size, f) == png_size);
+            fclose(f);
+        }
+    }
+    free(png);
+
+    return ok;
+}
+
+static void* s_buf_malloc_cb(size_t size, lv_color_format_t cf)
+{
+    // Decoded Png Buffer From libc
+
+    (void)cf;
+    return malloc(size);
+}
+
+static void s_buf_free_cb(void* p)
+{
+    // Decoded Png Buffer From libc
+
+    free(p);
+}
@@ -0,0 +1,13 @@
+// UI PNG
+// OCTOBER 19, 2026
+
+#ifndef _UI_PNG_
+#define _UI_PNG_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+bool UI_PNG_Read(const char* path, uint8_t* rgb, uint32_t w, uint32_t h);
+bool UI_PNG_Write(const char* path, const uint8_t* rgb, uint32_t w, uint32_t h);
+
+#endif
@@ -0,0 +1,24 @@
+// PROJECT DEFINES
+// OCTOBER 19, 2026
+
+#ifndef _PROJECT_DEFINES_
+#define _PROJECT_DEFINES_
+
+#define PROJECT_NAME                    ("Test_Ui_Render")
+
+#define DEBUG_TAG_MAIN                  ("Main")
+
+// Golden Frames
+// Run From The Project Directory (scripts/ui_render.sh). Set UI_RENDER_RECORD=1 To Rewrite Goldens
+#define UI_RENDER_GOLDEN_DIR            ("golden")
+#define UI_RENDER_OUTPUT_DIR            ("build/ui_render")
+#define UI_RENDER_GOLDEN_TOLERANCE      (8)         // Per Channel (0 - 255)
+#define UI_RENDER_GOLDEN_DIFF_MAX       (0)         // Pixels Allowed Outside Tolerance
+
+// SquareLine Project Assets (Background Art)
+#define UI_RENDER_ASSET_DIR             ("../mainapp/project_ui/assets/images")
+
+// Same Draw Buffer As driver_lcd (Partial Refresh)
+#define UI_RENDER_DRAW_BUF_BYTES        (100 * DRIVER_LCD_DISPLAY_HRES)
+
+#endif